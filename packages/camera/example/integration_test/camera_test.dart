@@ -2,10 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:async';
 import 'dart:io';
+import 'dart:math';
 import 'dart:ui';
 
 import 'package:camera/camera.dart';
+import 'package:camera_platform_interface/camera_platform_interface.dart'
+    show CameraPlatform;
+import 'package:camera_tizen/camera_tizen.dart';
 import 'package:flutter/painting.dart';
 import 'package:flutter_test/flutter_test.dart';
 import 'package:integration_test/integration_test.dart';
@@ -96,6 +101,142 @@ void main() {
     }
   });
 
+  testWidgets('Take a snapshot while recording', (WidgetTester tester) async {
+    final List<CameraDescription> cameras = await availableCameras();
+    if (cameras.isEmpty) {
+      return;
+    }
+
+    final CameraController controller = CameraController(
+      cameras[0],
+      ResolutionPreset.low,
+      enableAudio: false,
+    );
+    await controller.initialize();
+    await controller.prepareForVideoRecording();
+
+    await controller.startVideoRecording();
+    sleep(const Duration(milliseconds: 500));
+    final XFile snapshot = await (CameraPlatform.instance as CameraTizen)
+        .takeSnapshot(controller.cameraId);
+    expect(controller.value.isRecordingVideo, true);
+    await controller.stopVideoRecording();
+
+    final Image image = await decodeImageFromList(
+      File(snapshot.path).readAsBytesSync(),
+    );
+    expect(image.width, greaterThan(0));
+
+    await controller.dispose();
+  });
+
+  testWidgets('Capture a burst of images', (WidgetTester tester) async {
+    final List<CameraDescription> cameras = await availableCameras();
+    if (cameras.isEmpty) {
+      return;
+    }
+
+    final CameraController controller = CameraController(
+      cameras[0],
+      ResolutionPreset.low,
+      enableAudio: false,
+    );
+    await controller.initialize();
+
+    final CameraTizen camera = CameraPlatform.instance as CameraTizen;
+    try {
+      final List<XFile> files = await camera.takePictureBurst(
+        controller.cameraId,
+        3,
+        interval: const Duration(milliseconds: 100),
+      );
+      expect(files.length, 3);
+      expect(files.map((XFile file) => file.path).toSet().length, 3);
+      for (final XFile file in files) {
+        expect(File(file.path).lengthSync(), greaterThan(0));
+      }
+    } on CameraException catch (e) {
+      // Not all cameras support continuous capture.
+      expect(e.description, 'Burst capture is not supported');
+    }
+
+    await controller.dispose();
+  });
+
+  testWidgets('Select preview modes', (WidgetTester tester) async {
+    final List<CameraDescription> cameras = await availableCameras();
+    if (cameras.isEmpty) {
+      return;
+    }
+
+    final CameraController controller = CameraController(
+      cameras[0],
+      ResolutionPreset.medium,
+      enableAudio: false,
+    );
+    await controller.initialize();
+
+    final CameraTizen camera = CameraPlatform.instance as CameraTizen;
+    final List<CameraPreviewMode> modes = await camera.getSupportedPreviewModes(
+      controller.cameraId,
+    );
+    expect(modes, isNotEmpty);
+
+    final CameraPreviewMode selected = await camera.selectPreviewMode(
+      controller.cameraId,
+      width: 640,
+      height: 480,
+    );
+    expect(
+      modes.any(
+        (CameraPreviewMode mode) =>
+            mode.width == selected.width && mode.height == selected.height,
+      ),
+      isTrue,
+    );
+    final bool isLargeEnough = max(selected.width, selected.height) >= 640 &&
+        min(selected.width, selected.height) >= 480;
+    final bool hasLargeEnough = modes.any(
+      (CameraPreviewMode mode) =>
+          max(mode.width, mode.height) >= 640 &&
+          min(mode.width, mode.height) >= 480,
+    );
+    expect(isLargeEnough, hasLargeEnough);
+
+    await controller.dispose();
+  });
+
+  testWidgets('Preview stats', (WidgetTester tester) async {
+    final List<CameraDescription> cameras = await availableCameras();
+    if (cameras.isEmpty) {
+      return;
+    }
+
+    final CameraController controller = CameraController(
+      cameras[0],
+      ResolutionPreset.low,
+      enableAudio: false,
+    );
+    await controller.initialize();
+
+    final CameraTizen camera = CameraPlatform.instance as CameraTizen;
+    await camera.setMaxPreviewFrameRate(controller.cameraId, 10);
+    await camera.resetPreviewStats(controller.cameraId);
+    await Future<void>.delayed(const Duration(seconds: 1));
+
+    final CameraPreviewStats stats = await camera.getPreviewStats(
+      controller.cameraId,
+    );
+    expect(stats.framesDelivered, greaterThan(0));
+    expect(
+      stats.framesDropped + stats.framesReplaced + stats.framesPresented,
+      lessThanOrEqualTo(stats.framesDelivered + 1),
+    );
+    expect(stats.latencyP50, lessThanOrEqualTo(stats.latencyP99));
+
+    await controller.dispose();
+  });
+
   // This tests that the capture is no bigger than the preset, since we have
   // automatic code to fall back to smaller sizes when we need to. Returns
   // whether the image is exactly the desired resolution.
@@ -242,4 +383,37 @@ void main() {
     await controller.stopImageStream();
     await controller.dispose();
   }, skip: !Platform.isAndroid);
+
+  testWidgets('Image streaming', (WidgetTester tester) async {
+    final List<CameraDescription> cameras = await availableCameras();
+    if (cameras.isEmpty) {
+      return;
+    }
+
+    final CameraController controller = CameraController(
+      cameras[0],
+      ResolutionPreset.low,
+      enableAudio: false,
+    );
+    await controller.initialize();
+
+    final Completer<CameraImage> completer = Completer<CameraImage>();
+    await controller.startImageStream((CameraImage image) {
+      if (!completer.isCompleted) {
+        completer.complete(image);
+      }
+    });
+    expect(controller.value.isStreamingImages, true);
+
+    final CameraImage image =
+        await completer.future.timeout(const Duration(seconds: 5));
+    expect(image.planes, isNotEmpty);
+    for (final Plane plane in image.planes) {
+      expect(plane.bytesPerRow, greaterThan(0));
+      expect(plane.bytes.length, greaterThanOrEqualTo(plane.bytesPerRow));
+    }
+
+    await controller.stopImageStream();
+    await controller.dispose();
+  });
 }
@@ -11,9 +11,14 @@ import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
 import 'package:stream_transform/stream_transform.dart';
 
+import 'src/preview_mode.dart';
+import 'src/preview_stats.dart';
 import 'src/type_conversion.dart';
 import 'src/utils.dart';
 
+export 'src/preview_mode.dart';
+export 'src/preview_stats.dart';
+
 const MethodChannel _channel = MethodChannel('plugins.flutter.io/camera_tizen');
 
 /// A Tizen implementation of [CameraPlatform].
@@ -53,6 +58,13 @@ class CameraTizen extends CameraPlatform {
     return StreamController<DeviceEvent>.broadcast();
   }
 
+  /// The maximum number of frames per second delivered by
+  /// [onStreamedFrameAvailable], or 0 for no limit other than the preview
+  /// frame rate.
+  ///
+  /// Takes effect when the next image stream is started.
+  double imageStreamMaxFrameRate = 0;
+
   // The stream to receive frames from the native code.
   StreamSubscription<dynamic>? _platformImageStreamSubscription;
 
@@ -237,6 +249,131 @@ class CameraTizen extends CameraPlatform {
     return XFile(path);
   }
 
+  /// Saves the next preview frame of the camera as a JPEG file.
+  ///
+  /// Unlike [takePicture], this does not interrupt the preview or a video
+  /// recording, and the frame is not copied until it is encoded. The picture
+  /// has the resolution of the preview and is not rotated.
+  Future<XFile> takeSnapshot(int cameraId) async {
+    try {
+      final String? path = await _channel.invokeMethod<String>(
+        'takeSnapshot',
+        <String, dynamic>{'cameraId': cameraId},
+      );
+      return XFile(path!);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Takes [count] pictures in a row, [interval] apart, and returns them in
+  /// the order they were taken.
+  ///
+  /// Each picture is written to a file while the following ones are being
+  /// captured. Throws a [CameraException] if the camera does not support
+  /// continuous capture.
+  Future<List<XFile>> takePictureBurst(
+    int cameraId,
+    int count, {
+    Duration interval = Duration.zero,
+  }) async {
+    try {
+      final List<String>? paths = await _channel.invokeListMethod<String>(
+        'takePictureBurst',
+        <String, dynamic>{
+          'cameraId': cameraId,
+          'count': count,
+          'interval': interval.inMilliseconds,
+        },
+      );
+      return (paths ?? <String>[]).map((String path) => XFile(path)).toList();
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Returns the preview modes supported by the camera.
+  Future<List<CameraPreviewMode>> getSupportedPreviewModes(int cameraId) async {
+    final List<Map<dynamic, dynamic>>? modes = await _channel
+        .invokeListMethod<Map<dynamic, dynamic>>(
+      'getSupportedPreviewModes',
+      <String, dynamic>{'cameraId': cameraId},
+    );
+    return (modes ?? <Map<dynamic, dynamic>>[])
+        .map(CameraPreviewMode.fromMap)
+        .toList();
+  }
+
+  /// Switches the preview of the camera to the cheapest mode that is at least
+  /// [width] x [height] (in either orientation) at [fps] frames per second,
+  /// with an [aspectRatio] (long side / short side) within 5%.
+  ///
+  /// Requirements that are not given are not checked. If no mode satisfies
+  /// the aspect ratio, it is ignored. If no mode is large or fast enough, the
+  /// largest mode is used. Returns the selected mode.
+  ///
+  /// When created, the camera selects the cheapest mode that matches the
+  /// capture resolution of its resolution preset. If the preview is running,
+  /// it is restarted in the new mode. Note that the preview size reported at
+  /// initialization (e.g. `CameraValue.previewSize`) is not updated.
+  Future<CameraPreviewMode> selectPreviewMode(
+    int cameraId, {
+    int? width,
+    int? height,
+    int? fps,
+    double? aspectRatio,
+  }) async {
+    try {
+      final Map<dynamic, dynamic>? mode = await _channel
+          .invokeMapMethod<dynamic, dynamic>(
+        'selectPreviewMode',
+        <String, dynamic>{
+          'cameraId': cameraId,
+          'width': width ?? 0,
+          'height': height ?? 0,
+          'fps': fps ?? 0,
+          'aspectRatio': aspectRatio ?? 0.0,
+        },
+      );
+      return CameraPreviewMode.fromMap(mode!);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Returns the statistics of the preview frames of the camera since it was
+  /// initialized or [resetPreviewStats] was last called.
+  Future<CameraPreviewStats> getPreviewStats(int cameraId) async {
+    final Map<dynamic, dynamic>? stats = await _cameraChannel(cameraId)
+        .invokeMapMethod<dynamic, dynamic>('getPreviewStats');
+    return CameraPreviewStats.fromMap(stats!);
+  }
+
+  /// Resets the statistics of the preview frames of the camera.
+  Future<void> resetPreviewStats(int cameraId) =>
+      _cameraChannel(cameraId).invokeMethod<void>('resetPreviewStats');
+
+  /// Limits the preview of the camera to [maxFrameRate] frames per second, or
+  /// removes the limit if [maxFrameRate] is 0.
+  ///
+  /// The camera is also set to the lowest frame rate it supports above the
+  /// limit, which lowers its power consumption.
+  Future<void> setMaxPreviewFrameRate(int cameraId, double maxFrameRate) =>
+      _cameraChannel(
+        cameraId,
+      ).invokeMethod<void>('setMaxPreviewFrameRate', maxFrameRate);
+
+  MethodChannel _cameraChannel(int cameraId) {
+    final MethodChannel? channel = _channels[cameraId];
+    if (channel == null) {
+      throw CameraException(
+        'cameraNotInitialized',
+        'The camera $cameraId has not been initialized.',
+      );
+    }
+    return channel;
+  }
+
   @override
   Future<void> prepareForVideoRecording() =>
       _channel.invokeMethod<void>('prepareForVideoRecording');
@@ -300,7 +437,9 @@ class CameraTizen extends CameraPlatform {
   }
 
   Future<void> _startPlatformStream() async {
-    await _channel.invokeMethod<void>('startImageStream');
+    await _channel.invokeMethod<void>('startImageStream', <String, dynamic>{
+      'maxFrameRate': imageStreamMaxFrameRate,
+    });
     const EventChannel cameraEventChannel = EventChannel(
       'plugins.flutter.io/camera_tizen/imageStream',
     );
@@ -309,6 +448,8 @@ class CameraTizen extends CameraPlatform {
       _frameStreamController!.add(
         cameraImageFromPlatformData(imageData as Map<dynamic, dynamic>),
       );
+      // The next frame is not sent until this one has been received.
+      _channel.invokeMethod<void>('receivedImageStreamData');
     });
   }
 
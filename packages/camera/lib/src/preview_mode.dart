@@ -0,0 +1,37 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// A preview resolution and frame rate supported by a camera.
+///
+/// Sizes are in the orientation of the camera sensor.
+class CameraPreviewMode {
+  /// Creates a [CameraPreviewMode].
+  const CameraPreviewMode({
+    required this.width,
+    required this.height,
+    required this.fps,
+  });
+
+  /// Creates a [CameraPreviewMode] from a platform channel reply.
+  factory CameraPreviewMode.fromMap(Map<dynamic, dynamic> map) {
+    return CameraPreviewMode(
+      width: map['width'] as int,
+      height: map['height'] as int,
+      fps: map['fps'] as int,
+    );
+  }
+
+  /// The width of the preview in pixels.
+  final int width;
+
+  /// The height of the preview in pixels.
+  final int height;
+
+  /// The frame rate of the preview, or 0 if the camera chooses it or does not
+  /// report it.
+  final int fps;
+
+  @override
+  String toString() => 'CameraPreviewMode(${width}x$height, $fps fps)';
+}
@@ -0,0 +1,54 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// Statistics of the preview frames of a camera.
+class CameraPreviewStats {
+  /// Creates a [CameraPreviewStats].
+  const CameraPreviewStats({
+    required this.framesDelivered,
+    required this.framesDropped,
+    required this.framesReplaced,
+    required this.framesPresented,
+    required this.latencyP50,
+    required this.latencyP90,
+    required this.latencyP99,
+  });
+
+  /// Creates a [CameraPreviewStats] from a platform channel reply.
+  factory CameraPreviewStats.fromMap(Map<dynamic, dynamic> map) {
+    return CameraPreviewStats(
+      framesDelivered: map['framesDelivered'] as int,
+      framesDropped: map['framesDropped'] as int,
+      framesReplaced: map['framesReplaced'] as int,
+      framesPresented: map['framesPresented'] as int,
+      latencyP50: Duration(microseconds: map['latencyP50'] as int),
+      latencyP90: Duration(microseconds: map['latencyP90'] as int),
+      latencyP99: Duration(microseconds: map['latencyP99'] as int),
+    );
+  }
+
+  /// The number of frames delivered by the camera.
+  final int framesDelivered;
+
+  /// The number of frames dropped because the preview was paused or over the
+  /// maximum preview frame rate.
+  final int framesDropped;
+
+  /// The number of frames replaced by a newer frame before the texture
+  /// sampled them.
+  final int framesReplaced;
+
+  /// The number of frames sampled by the texture.
+  final int framesPresented;
+
+  /// The median time from the delivery of a frame to its presentation, over
+  /// the most recent frames.
+  final Duration latencyP50;
+
+  /// The 90th percentile of the delivery-to-presentation latency.
+  final Duration latencyP90;
+
+  /// The 99th percentile of the delivery-to-presentation latency.
+  final Duration latencyP99;
+}
@@ -6,8 +6,7 @@ import 'dart:typed_data';
 
 import 'package:camera_platform_interface/camera_platform_interface.dart';
 
-/// Converts method channel call [data] for `receivedImageStreamData` to a
-/// [CameraImageData].
+/// Converts an image stream event [data] to a [CameraImageData].
 CameraImageData cameraImageFromPlatformData(Map<dynamic, dynamic> data) {
   return CameraImageData(
     format: _cameraImageFormatFromPlatformData(data['format']),
@@ -32,6 +31,10 @@ CameraImageFormat _cameraImageFormatFromPlatformData(dynamic data) {
 
 ImageFormatGroup _imageFormatGroupFromPlatformData(dynamic data) {
   switch (data) {
+    case 0: // CAMERA_PIXEL_FORMAT_NV12
+      return ImageFormatGroup.yuv420;
+    case 1: // CAMERA_PIXEL_FORMAT_NV21
+      return ImageFormatGroup.nv21;
     case 7: // CAMERA_PIXEL_FORMAT_I420
       return ImageFormatGroup.yuv420;
     case 13: // CAMERA_PIXEL_FORMAT_JPEG
@@ -8,9 +8,13 @@
 #include <flutter/encodable_value.h>
 #include <sys/time.h>
 
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <memory>
 
 #include "log.h"
+#include "preview_snapshot.h"
 
 // These macros came from tizen camera_app
 #define VIDEO_ENCODE_BITRATE 40000000 /* bps */
@@ -18,6 +22,18 @@
 
 namespace {
 
+// Enumerating the preview modes of a camera takes many calls, so they are
+// only enumerated the first time the camera is used.
+struct PreviewModesCache {
+  std::mutex mutex;
+  std::map<CameraDeviceType, std::vector<PreviewMode>> modes;
+};
+
+PreviewModesCache &GetPreviewModesCache() {
+  static PreviewModesCache cache;
+  return cache;
+}
+
 uint64_t Timestamp() {
   struct timeval tv;
   gettimeofday(&tv, nullptr);
@@ -328,6 +344,27 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
 
   SetResolutionPreset(resolution_preset_);
 
+  // Use the cheapest preview mode that matches the capture resolution of the
+  // preset, rather than a default that may be much larger.
+  preview_mode_selector_ = std::make_unique<PreviewModeSelector>(
+      GetCameraSupportedPreviewModes(), supported_recorder_resolutions_);
+  int capture_width = 0, capture_height = 0;
+  if (GetCameraCaptureResolution(capture_width, capture_height) &&
+      capture_width > 0 && capture_height > 0) {
+    PreviewModeRequest request;
+    request.width = capture_width;
+    request.height = capture_height;
+    request.aspect_ratio =
+        static_cast<double>(std::max(capture_width, capture_height)) /
+        std::min(capture_width, capture_height);
+    try {
+      SelectPreviewMode(request);
+    } catch (const CameraDeviceError &error) {
+      LOG_WARN("[%s] %s", error.GetErrorCode().c_str(),
+               error.GetErrorMessage().c_str());
+    }
+  }
+
   // Init channels
   texture_variant_ =
       std::make_unique<flutter::TextureVariant>(flutter::GpuSurfaceTexture(
@@ -339,10 +376,10 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
               return nullptr;
             }
             tbm_surface_h surface = nullptr;
-            int ret = media_packet_get_tbm_surface(current_packet_, &surface);
+            int ret =
+                media_packet_get_tbm_surface(current_packet_.get(), &surface);
             if (ret != MEDIA_PACKET_ERROR_NONE) {
               LOG_ERROR("media_packet_get_tbm_surface failed, error: %d", ret);
-              media_packet_destroy(current_packet_);
               current_packet_ = nullptr;
               return nullptr;
             }
@@ -354,6 +391,10 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
               cd->ReleaseMediaPacket();
             };
             gpu_surface_->release_context = this;
+            preview_stats_.OnFramePresented(current_packet_time_);
+            // Kept until the surface is released, while newer frames are
+            // already being delivered.
+            presented_packets_.push_back(std::move(current_packet_));
             return gpu_surface_.get();
           }));
   texture_id_ =
@@ -364,6 +405,30 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
   camera_method_channel_ =
       std::make_unique<CameraMethodChannel>(registrar_, texture_id_);
   device_method_channel_ = std::make_unique<DeviceMethodChannel>(registrar_);
+  image_stream_channel_ = std::make_unique<ImageStreamChannel>(registrar_);
+  camera_method_channel_->SetMethodCallHandler(
+      [this](const flutter::MethodCall<flutter::EncodableValue> &method_call,
+             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
+                 result) {
+        const std::string &method_name = method_call.method_name();
+        if (method_name == "getPreviewStats") {
+          result->Success(flutter::EncodableValue(GetPreviewStats()));
+        } else if (method_name == "resetPreviewStats") {
+          ResetPreviewStats();
+          result->Success();
+        } else if (method_name == "setMaxPreviewFrameRate") {
+          const auto *max_frame_rate =
+              std::get_if<double>(method_call.arguments());
+          if (!max_frame_rate || *max_frame_rate < 0) {
+            result->Error("InvalidArguments", "Please check 'maxFrameRate'");
+            return;
+          }
+          SetMaxPreviewFrameRate(*max_frame_rate);
+          result->Success();
+        } else {
+          result->NotImplemented();
+        }
+      });
 
   int angle = 0;
   GetCameraLensOrientation(angle);
@@ -380,10 +445,114 @@ CameraDevice::~CameraDevice() { Dispose(); }
 
 void CameraDevice::ReleaseMediaPacket() {
   std::lock_guard<std::mutex> lock(mutex_);
-  if (current_packet_) {
-    media_packet_destroy(current_packet_);
-    current_packet_ = nullptr;
+  // Surfaces are released in the order they were presented.
+  if (!presented_packets_.empty()) {
+    presented_packets_.pop_front();
+  }
+}
+
+PreviewMode CameraDevice::SelectPreviewMode(
+    const PreviewModeRequest &request) {
+  std::optional<PreviewMode> mode = preview_mode_selector_->Select(request);
+  if (!mode) {
+    throw CameraDeviceError("No supported preview mode");
+  }
+  LOG_DEBUG("Selected preview mode width[%d] height[%d] fps[%d]", mode->width,
+            mode->height, mode->fps);
+
+  // The preview resolution can only be changed while the preview is stopped,
+  // which would interrupt a recording.
+  UpdateStates();
+  if (recorder_state_ == RecorderState::kRecording ||
+      recorder_state_ == RecorderState::kPaused) {
+    throw CameraDeviceError("Cannot change the preview mode while recording");
+  }
+  bool was_previewing = camera_state_ == CameraDeviceState::kPreview;
+  if (was_previewing && !StopCameraPreview()) {
+    throw CameraDeviceError("Failed to stop preview");
+  }
+  bool is_set = SetCameraPreviewSize(Size{static_cast<double>(mode->width),
+                                          static_cast<double>(mode->height)});
+  if (is_set) {
+    // Without a requested rate the camera chooses it, so the rate of the
+    // selected mode does not apply.
+    if (request.fps <= 0) {
+      mode->fps = 0;
+    }
+    preview_mode_fps_ = mode->fps > 0 ? mode->fps : CAMERA_ATTR_FPS_AUTO;
+    ApplyPreviewFps();
+  }
+  GetCameraPreviewResolution(preview_width_, preview_height_);
+  if (was_previewing) {
+    StartCameraPreview();
   }
+  UpdateStates();
+  if (!is_set) {
+    throw CameraDeviceError("Failed to set preview resolution");
+  }
+  return *mode;
+}
+
+void CameraDevice::SetMaxPreviewFrameRate(double max_frame_rate) {
+  max_preview_frame_rate_ = max_frame_rate;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (max_frame_rate > 0) {
+      min_preview_frame_interval_ =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double>(1.0 / max_frame_rate));
+    } else {
+      min_preview_frame_interval_ = std::chrono::steady_clock::duration::zero();
+    }
+  }
+  ApplyPreviewFps();
+}
+
+void CameraDevice::ApplyPreviewFps() {
+  // Frames over the limit are dropped when they arrive, but letting the
+  // camera produce fewer frames in the first place also saves power. Pick
+  // the lowest supported rate that still satisfies the limit, unless the
+  // selected preview mode is already slower. Without a limit, go back to the
+  // rate of the selected preview mode.
+  double max_frame_rate = max_preview_frame_rate_;
+  int fps = preview_mode_fps_;
+  if (max_frame_rate > 0) {
+    int limited_fps = CAMERA_ATTR_FPS_AUTO;
+    ForeachCameraSupportedPreviewFps(
+        [&limited_fps, max_frame_rate](int supported) {
+          if (supported >= max_frame_rate &&
+              (limited_fps == CAMERA_ATTR_FPS_AUTO ||
+               supported < limited_fps)) {
+            limited_fps = supported;
+          }
+          return true;
+        });
+    if (limited_fps != CAMERA_ATTR_FPS_AUTO &&
+        (fps == CAMERA_ATTR_FPS_AUTO || limited_fps < fps)) {
+      fps = limited_fps;
+    }
+  }
+  SetCameraPreviewFps(fps);
+}
+
+flutter::EncodableMap CameraDevice::GetPreviewStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return preview_stats_.ToEncodableMap();
+}
+
+void CameraDevice::ResetPreviewStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  preview_stats_.Reset();
+}
+
+void CameraDevice::StartImageStream(double max_frame_rate) {
+  image_stream_channel_->Start(max_frame_rate);
+}
+
+void CameraDevice::StopImageStream() { image_stream_channel_->Stop(); }
+
+void CameraDevice::OnImageStreamFrameReceived() {
+  image_stream_channel_->OnFrameReceived();
 }
 
 bool CameraDevice::CreateCamera() {
@@ -421,6 +590,15 @@ void CameraDevice::ChangeCameraDeviceType(CameraDeviceType type) {
 
 void CameraDevice::Dispose() {
   LOG_DEBUG("enter");
+  // The messenger keeps the handler after the channel is destroyed.
+  if (camera_method_channel_) {
+    camera_method_channel_->SetMethodCallHandler(nullptr);
+  }
+
+  if (image_stream_channel_) {
+    image_stream_channel_->Stop();
+  }
+
   if (recorder_) {
     DestroyRecorder();
   }
@@ -442,10 +620,13 @@ void CameraDevice::Dispose() {
     registrar_->texture_registrar()->UnregisterTexture(texture_id_, nullptr);
   }
 
-  if (current_packet_) {
-    media_packet_destroy(current_packet_);
-    current_packet_ = nullptr;
+  std::lock_guard<std::mutex> lock(mutex_);
+  current_packet_ = nullptr;
+  presented_packets_.clear();
+  for (auto &snapshot : pending_snapshots_) {
+    snapshot->Error(kCameraDeviceError, "Camera disposed");
   }
+  pending_snapshots_.clear();
 }
 
 bool CameraDevice::ForeachCameraSupportedCaptureResolutions(
@@ -464,6 +645,53 @@ bool CameraDevice::ForeachCameraSupportedCaptureResolutions(
   return true;
 }
 
+bool CameraDevice::ForeachCameraSupportedPreviewFps(
+    const ForeachFpsCb &callback) {
+  int error = camera_attr_foreach_supported_fps(
+      camera_,
+      [](camera_attr_fps_e fps, void *callback) -> bool {
+        auto cb = static_cast<ForeachFpsCb *>(callback);
+        return (*cb)(static_cast<int>(fps));
+      },
+      (void *)&callback);
+  RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
+                    "camera_attr_foreach_supported_fps fail - error[%d]: %s",
+                    error, get_error_message(error));
+  return true;
+}
+
+bool CameraDevice::ForeachCameraSupportedPreviewFpsByResolution(
+    int width, int height, const ForeachFpsCb &callback) {
+  int error = camera_attr_foreach_supported_fps_by_resolution(
+      camera_, width, height,
+      [](camera_attr_fps_e fps, void *callback) -> bool {
+        auto cb = static_cast<ForeachFpsCb *>(callback);
+        return (*cb)(static_cast<int>(fps));
+      },
+      (void *)&callback);
+  RETV_LOG_ERROR_IF(
+      error != CAMERA_ERROR_NONE, false,
+      "camera_attr_foreach_supported_fps_by_resolution fail - error[%d]: %s",
+      error, get_error_message(error));
+  return true;
+}
+
+bool CameraDevice::ForeachCameraSupportedPreviewResolutions(
+    const ForeachResolutionCb &callback) {
+  int error = camera_foreach_supported_preview_resolution(
+      camera_,
+      [](int width, int height, void *callback) -> bool {
+        auto cb = static_cast<ForeachResolutionCb *>(callback);
+        return (*cb)(width, height);
+      },
+      (void *)&callback);
+  RETV_LOG_ERROR_IF(
+      error != CAMERA_ERROR_NONE, false,
+      "camera_foreach_supported_preview_resolution fail - error[%d]: %s", error,
+      get_error_message(error));
+  return true;
+}
+
 bool CameraDevice::GetCameraCaptureResolution(int &width, int &height) {
   int error = camera_get_capture_resolution(camera_, &width, &height);
   RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
@@ -892,18 +1120,63 @@ bool CameraDevice::UnsetRecorderRecordingLimitReachedCb() {
   return true;
 }
 
+std::vector<PreviewMode> CameraDevice::GetCameraSupportedPreviewModes() {
+  PreviewModesCache &cache = GetPreviewModesCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto iter = cache.modes.find(type_);
+    if (iter != cache.modes.end()) {
+      return iter->second;
+    }
+  }
+
+  std::vector<int> all_fps;
+  ForeachCameraSupportedPreviewFps([&all_fps](int fps) -> bool {
+    if (fps > 0) {
+      all_fps.push_back(fps);
+    }
+    return true;
+  });
+
+  std::vector<PreviewMode> modes;
+  ForeachCameraSupportedPreviewResolutions(
+      [this, &modes, &all_fps](int width, int height) -> bool {
+        std::vector<int> fps_list;
+        if (!ForeachCameraSupportedPreviewFpsByResolution(
+                width, height, [&fps_list](int fps) -> bool {
+                  if (fps > 0) {
+                    fps_list.push_back(fps);
+                  }
+                  return true;
+                })) {
+          fps_list = all_fps;
+        }
+        if (fps_list.empty()) {
+          modes.push_back(PreviewMode{width, height, 0});
+        }
+        for (int fps : fps_list) {
+          LOG_DEBUG("supported preview mode width[%d] height[%d] fps[%d]",
+                    width, height, fps);
+          modes.push_back(PreviewMode{width, height, fps});
+        }
+        return true;
+      });
+  if (!modes.empty()) {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.modes[type_] = modes;
+  }
+  return modes;
+}
+
 void CameraDevice::UpdateStates() {
   GetCameraState(camera_state_);
   GetRecorderState(recorder_state_);
 }
 
-Size CameraDevice::GetRecommendedPreviewResolution() {
+Size CameraDevice::GetPreviewResolution() {
   Size preview_size;
-  int w, h;
-  int error = camera_get_recommended_preview_resolution(camera_, &w, &h);
-  LOG_ERROR_IF(error != CAMERA_ERROR_NONE,
-               "camera_get_recommended_preview_resolution fail - error[%d]: %s",
-               error, get_error_message(error));
+  int w = 0, h = 0;
+  GetCameraPreviewResolution(w, h);
 
   auto target_orientation =
       orientation_manager_->ConvertOrientation(OrientationType::kPortraitUp);
@@ -967,18 +1240,55 @@ void CameraDevice::Open(
 
   if (!SetCameraMediaPacketPreviewCb([](media_packet_h packet, void *data) {
         auto self = static_cast<CameraDevice *>(data);
+        auto now = std::chrono::steady_clock::now();
+        // The frame is shared by the texture, the image stream and
+        // snapshots without being copied, and destroyed when all of them
+        // are done with it.
+        SharedMediaPacket frame = MakeSharedMediaPacket(packet);
+        std::vector<
+            std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>>
+            snapshots;
+        {
+          std::lock_guard<std::mutex> lock(self->mutex_);
+          snapshots.swap(self->pending_snapshots_);
+        }
+        if (!snapshots.empty()) {
+          self->WriteSnapshot(frame, std::move(snapshots));
+        }
+        {
+          std::lock_guard<std::mutex> lock(self->mutex_);
+          self->preview_stats_.OnFrameDelivered();
+          auto interval = self->min_preview_frame_interval_;
+          if (now - self->last_preview_frame_time_ < interval) {
+            self->preview_stats_.OnFrameDropped();
+            return;
+          }
+          // Advance by whole intervals so that frames arriving slightly
+          // early because of jitter are not dropped, but start over after a
+          // gap so that the frames following it are not let through back to
+          // back.
+          if (now - self->last_preview_frame_time_ >= 2 * interval) {
+            self->last_preview_frame_time_ = now;
+          } else {
+            self->last_preview_frame_time_ += interval;
+          }
+        }
+        self->image_stream_channel_->OnPreviewFrame(frame);
         std::lock_guard<std::mutex> lock(self->mutex_);
-        if (self->current_packet_) {
-          media_packet_destroy(self->current_packet_);
-          self->current_packet_ = packet;
+        if (self->is_preview_paused_) {
+          self->preview_stats_.OnFrameDropped();
           return;
         }
-        if (self->is_preview_paused_) {
-          media_packet_destroy(packet);
-          self->current_packet_ = nullptr;
+        if (self->current_packet_) {
+          // The texture has not sampled the previous frame yet, so it is
+          // already marked as available.
+          self->preview_stats_.OnFrameReplaced();
+          self->current_packet_ = std::move(frame);
+          self->current_packet_time_ = now;
           return;
         }
-        self->current_packet_ = packet;
+        self->current_packet_ = std::move(frame);
+        self->current_packet_time_ = now;
         self->registrar_->texture_registrar()->MarkTextureFrameAvailable(
             self->texture_id_);
       })) {
@@ -1006,7 +1316,7 @@ void CameraDevice::Open(
   }
 
   flutter::EncodableMap map;
-  Size size = GetRecommendedPreviewResolution();
+  Size size = GetPreviewResolution();
   map[flutter::EncodableValue("previewWidth")] =
       flutter::EncodableValue(size.width);
   map[flutter::EncodableValue("previewHeight")] =
@@ -1297,11 +1607,14 @@ void CameraDevice::TakePicture(
       type_ == CameraDeviceType::kFront));
   auto p_result = result.release();
   if (!StartCameraCapture(
-          [p_result, this](const std::string &captured_file_path) {
-            flutter::EncodableValue value(captured_file_path);
-            p_result->Success(value);
+          1, 0,
+          [this]() {
             StartCameraPreview();
             UpdateStates();
+          },
+          [p_result](const std::vector<std::string> &captured_file_paths) {
+            flutter::EncodableValue value(captured_file_paths.front());
+            p_result->Success(value);
             delete p_result;
           },
           [p_result](const std::string &code, const std::string &message) {
@@ -1314,6 +1627,80 @@ void CameraDevice::TakePicture(
   UpdateStates();
 }
 
+void CameraDevice::TakePictureBurst(
+    int count, int interval_ms,
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
+        &&result) noexcept {
+  if (count > 1 && !camera_is_supported_continuous_capture(camera_)) {
+    result->Error(kCameraDeviceError, "Burst capture is not supported");
+    return;
+  }
+  SetCameraExifTagOrientatoin(ChooseExifTagOrientatoin(
+      is_orientation_locked_ ? locked_orientation_
+                             : orientation_manager_->GetDeviceOrientationType(),
+      type_ == CameraDeviceType::kFront));
+  auto p_result = result.release();
+  if (!StartCameraCapture(
+          count, interval_ms,
+          [this]() {
+            StartCameraPreview();
+            UpdateStates();
+          },
+          [p_result](const std::vector<std::string> &captured_file_paths) {
+            flutter::EncodableList paths;
+            for (const std::string &path : captured_file_paths) {
+              paths.push_back(flutter::EncodableValue(path));
+            }
+            p_result->Success(flutter::EncodableValue(paths));
+            delete p_result;
+          },
+          [p_result](const std::string &code, const std::string &message) {
+            p_result->Error(code, message);
+            delete p_result;
+          })) {
+    p_result->Error(kCameraDeviceError, "Failed to take pictures");
+    delete p_result;
+  }
+  UpdateStates();
+}
+
+void CameraDevice::TakeSnapshot(
+    std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
+        &&result) noexcept {
+  UpdateStates();
+  if (camera_state_ != CameraDeviceState::kPreview) {
+    result->Error(kCameraDeviceError, "Preview is not running");
+    return;
+  }
+  // The next preview frame is written by the preview callback.
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_snapshots_.push_back(std::move(result));
+}
+
+void CameraDevice::WriteSnapshot(
+    SharedMediaPacket packet,
+    std::vector<std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>>
+        &&results) {
+  std::string path = CreateTempFileName("SNAP", "jpg");
+  auto p_results = std::make_shared<std::vector<
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>>>(
+      std::move(results));
+  capture_writer_.PostTask([packet = std::move(packet), path,
+                            p_results]() mutable {
+    bool is_written =
+        path.size() && WritePreviewSnapshot(std::move(packet), path);
+    RunOnPlatformThread([is_written, path, p_results]() {
+      for (auto &result : *p_results) {
+        if (is_written) {
+          result->Success(flutter::EncodableValue(path));
+        } else {
+          result->Error(kCameraDeviceError, "Failed to take snapshot");
+        }
+      }
+    });
+  });
+}
+
 void CameraDevice::LockCaptureOrientation(OrientationType orientation) {
   locked_orientation_ =
       orientation_manager_->ConvertOrientation(orientation, false);
@@ -1345,6 +1732,14 @@ bool CameraDevice::SetCameraPreviewCb(CameraPrivewCb callback) {
   return true;
 }
 
+bool CameraDevice::SetCameraPreviewFps(int fps) {
+  int error = camera_attr_set_preview_fps(camera_, (camera_attr_fps_e)fps);
+  RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
+                    "camera_attr_set_preview_fps fail - error[%d]: %s", error,
+                    get_error_message(error));
+  return true;
+}
+
 bool CameraDevice::SetCameraPreviewFormat(CameraPixelFormat format) {
   int error = camera_set_preview_format(camera_, (camera_pixel_format_e)format);
   RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
@@ -1375,61 +1770,109 @@ bool CameraDevice::SetCameraZoom(int zoom) {
   return true;
 }
 
-bool CameraDevice::StartCameraCapture(const OnCaptureSuccessCb &on_success,
+bool CameraDevice::StartCameraCapture(int count, int interval_ms,
+                                      const OnCaptureCompletedCb &on_completed,
+                                      const OnCaptureSuccessCb &on_success,
                                       const OnCaptureFailureCb &on_failure) {
+  // Images are copied in the capturing callback and written on
+  // |capture_writer_|, so that the camera can go on with the next shot (or
+  // complete the capture) while the previous one is being written. The
+  // result is reported once all images have been written.
   struct Param {
+    int count;
+    int shot{0};
+    OnCaptureCompletedCb on_completed;
     OnCaptureSuccessCb on_success;
     OnCaptureFailureCb on_failure;
-    std::string captured_file_path;
+    WorkerThread *writer;
+    // Only accessed on |writer|.
+    std::vector<std::string> captured_file_paths;
     std::string error;
     std::string error_message;
   };
 
-  Param *p = new Param;  // Must delete on capture_completed_callback
+  Param *p = new Param;  // Must delete after capture_completed_callback
+  p->count = count;
+  p->on_completed = on_completed;
   p->on_success = on_success;
   p->on_failure = on_failure;
+  p->writer = &capture_writer_;
 
-  int error = camera_start_capture(
-      camera_,
+  CameraCapturingCb capturing_callback =
       [](camera_image_data_s *image, camera_image_data_s *postview,
          camera_image_data_s *thumbnail, void *user_data) {
         Param *p = (Param *)user_data;
         if (!image || !image->data) {
-          p->error = "Capturing error";
-          p->error_message = "camera_start_capture fail";
-          return;
-        }
-
-        p->captured_file_path = CreateTempFileName("CAP", "jpg");
-        if (!p->captured_file_path.size()) {
-          p->error = "Insufficient memory";
-          p->error_message = "app_get_cache_path fail";
-          return;
-        }
-
-        FILE *file = fopen(p->captured_file_path.c_str(), "w+");
-        if (!file) {
-          p->error = "Insufficient memory";
-          p->error_message = "fopen fail";
+          p->writer->PostTask([p]() {
+            p->error = "Capturing error";
+            p->error_message = "camera_start_capture fail";
+          });
           return;
         }
 
-        if (fwrite(image->data, 1, image->size, file) != image->size) {
-          p->error = "Insufficient memory";
-          p->error_message = "fwrite fail";
+        // Shots of a burst may be taken within the same millisecond.
+        std::string prefix = "CAP";
+        if (p->count > 1) {
+          prefix += std::to_string(p->shot) + "_";
         }
-        fclose(file);
-      },
-      [](void *user_data) {
-        Param *p = (Param *)user_data;
+        p->shot++;
+        std::string path = CreateTempFileName(prefix, "jpg");
+        auto data = std::make_shared<std::vector<unsigned char>>(
+            image->data, image->data + image->size);
+        p->writer->PostTask([p, path, data]() {
+          if (p->error.size()) {
+            return;
+          }
+          if (!path.size()) {
+            p->error = "Insufficient memory";
+            p->error_message = "app_get_cache_path fail";
+            return;
+          }
+
+          FILE *file = fopen(path.c_str(), "w+");
+          if (!file) {
+            p->error = "Insufficient memory";
+            p->error_message = "fopen fail";
+            return;
+          }
+
+          if (fwrite(data->data(), 1, data->size(), file) != data->size()) {
+            p->error = "Insufficient memory";
+            p->error_message = "fwrite fail";
+          }
+          fclose(file);
+          p->captured_file_paths.push_back(path);
+        });
+      };
+  CameraCaptureCompletedCb completed_callback = [](void *user_data) {
+    Param *p = (Param *)user_data;
+    p->on_completed();
+    // Runs after all the images of this capture have been written.
+    p->writer->PostTask([p]() {
+      if (!p->error.size() && p->captured_file_paths.empty()) {
+        p->error = "Capturing error";
+        p->error_message = "No image captured";
+      }
+      RunOnPlatformThread([p]() {
         if (p->error.size()) {
           p->on_failure(p->error, p->error_message);
         } else {
-          p->on_success(p->captured_file_path);
+          p->on_success(p->captured_file_paths);
         }
         delete p;
-      },
-      p);
+      });
+    });
+  };
+
+  int error;
+  if (count > 1) {
+    error = camera_start_continuous_capture(camera_, count, interval_ms,
+                                            capturing_callback,
+                                            completed_callback, p);
+  } else {
+    error = camera_start_capture(camera_, capturing_callback,
+                                 completed_callback, p);
+  }
   LOG_ERROR_IF(error != CAMERA_ERROR_NONE,
                "camera_start_capture fail - error[%d]: %s", error,
                get_error_message(error));
@@ -11,11 +11,20 @@
 #include <flutter/plugin_registrar.h>
 #include <recorder.h>
 
+#include <chrono>
+#include <deque>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include "camera_method_channel.h"
 #include "device_method_channel.h"
+#include "image_stream_channel.h"
 #include "orientation_manager.h"
+#include "preview_mode_selector.h"
+#include "preview_stats.h"
+#include "shared_media_packet.h"
+#include "worker_thread.h"
 
 #define kCameraDeviceError "CameraDeviceError"
 
@@ -30,8 +39,10 @@ using RecorderStateChangedCb = recorder_state_changed_cb;
 using RecorderStateChangedCb = recorder_state_changed_cb;
 
 using ForeachResolutionCb = std::function<bool(int width, int height)>;
+using ForeachFpsCb = std::function<bool(int fps)>;
+using OnCaptureCompletedCb = std::function<void()>;
 using OnCaptureSuccessCb =
-    std::function<void(const std::string &captured_file_path)>;
+    std::function<void(const std::vector<std::string> &captured_file_paths)>;
 using OnCaptureFailureCb =
     std::function<void(const std::string &code, const std::string &message)>;
 
@@ -214,7 +225,7 @@ class CameraDevice {
 
   void ChangeCameraDeviceType(CameraDeviceType type);
   void Dispose();
-  Size GetRecommendedPreviewResolution();
+  Size GetPreviewResolution();
   long GetTextureId() { return texture_id_; }
   double GetMaxExposureOffset();
   double GetMinExposureOffset();
@@ -246,6 +257,15 @@ class CameraDevice {
   void TakePicture(
       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
           &&result) noexcept;
+  // Saves the next preview frame as a JPEG file, without interrupting the
+  // preview or a recording.
+  void TakeSnapshot(
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
+          &&result) noexcept;
+  void TakePictureBurst(
+      int count, int interval_ms,
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
+          &&result) noexcept;
 
   void LockCaptureOrientation(OrientationType orientation);
   void UnlockCaptureOrientation();
@@ -255,12 +275,33 @@ class CameraDevice {
 
   void ReleaseMediaPacket();
 
+  const std::vector<PreviewMode> &GetSupportedPreviewModes() {
+    return preview_mode_selector_->modes();
+  }
+  // Switches the preview to the cheapest mode satisfying |request| and
+  // returns it.
+  PreviewMode SelectPreviewMode(const PreviewModeRequest &request);
+
+  // A |max_frame_rate| of 0 means no limit.
+  void SetMaxPreviewFrameRate(double max_frame_rate);
+  flutter::EncodableMap GetPreviewStats();
+  void ResetPreviewStats();
+
+  void StartImageStream(double max_frame_rate);
+  void StopImageStream();
+  void OnImageStreamFrameReceived();
+
  private:
   bool CreateCamera();
   bool ClearCameraAutoFocusArea();
   bool DestroyCamera();
   bool ForeachCameraSupportedCaptureResolutions(
       const ForeachResolutionCb &callback);
+  bool ForeachCameraSupportedPreviewFps(const ForeachFpsCb &callback);
+  bool ForeachCameraSupportedPreviewFpsByResolution(
+      int width, int height, const ForeachFpsCb &callback);
+  bool ForeachCameraSupportedPreviewResolutions(
+      const ForeachResolutionCb &callback);
   bool GetCameraCaptureResolution(int &width, int &height);
   bool GetCameraDeviceCount(int &count);
   bool GetCameraFocusMode(CameraAutoFocusMode &mode);
@@ -283,10 +324,13 @@ class CameraDevice {
   bool SetCameraAutoFocusChangedCb(CameraFocusChangedCb callback);
   bool SetCameraMediaPacketPreviewCb(CameraMediaPacketPreviewCb callback);
   bool SetCameraPreviewCb(CameraPrivewCb callback);
+  bool SetCameraPreviewFps(int fps);
   bool SetCameraPreviewFormat(CameraPixelFormat format);
   bool SetCameraPreviewSize(Size size);
   bool SetCameraZoom(int zoom);
-  bool StartCameraCapture(const OnCaptureSuccessCb &on_success,
+  bool StartCameraCapture(int count, int interval_ms,
+                          const OnCaptureCompletedCb &on_completed,
+                          const OnCaptureSuccessCb &on_success,
                           const OnCaptureFailureCb &on_failure);
   bool StartCameraAutoFocusing(bool continuous);
   bool StartCameraPreview();
@@ -294,6 +338,14 @@ class CameraDevice {
   bool StopCameraPreview();
   bool UnsetCameraMediaPacketPreviewCb();
   bool UnsetCameraAutoFocusChangedCb();
+  // Sets the preview fps from the selected mode and the frame rate limit.
+  void ApplyPreviewFps();
+  // Writes |packet| to a JPEG file and reports its path to all |results|.
+  void WriteSnapshot(
+      SharedMediaPacket packet,
+      std::vector<
+          std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>>
+          &&results);
 
   bool CancleRecorder();
   bool CreateRecorder();
@@ -324,18 +376,35 @@ class CameraDevice {
   bool StartRecorder();
   bool UnprepareRecorder();
   bool UnsetRecorderRecordingLimitReachedCb();
+  std::vector<PreviewMode> GetCameraSupportedPreviewModes();
   void UpdateStates();
 
   long texture_id_{0};
   flutter::PluginRegistrar *registrar_{nullptr};
   std::unique_ptr<flutter::TextureVariant> texture_variant_;
   std::unique_ptr<FlutterDesktopGpuSurfaceDescriptor> gpu_surface_;
-  media_packet_h current_packet_{nullptr};
+
+  // The following are guarded by |mutex_|.
+  // The latest frame if it has not been presented yet.
+  SharedMediaPacket current_packet_;
+  std::chrono::steady_clock::time_point current_packet_time_;
+  // Frames of which the surfaces are still in use by the texture.
+  std::deque<SharedMediaPacket> presented_packets_;
+  // Snapshots waiting for the next frame. Frames are not kept around for
+  // snapshots, since the camera has few preview buffers.
+  std::vector<std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>>
+      pending_snapshots_;
+  std::chrono::steady_clock::duration min_preview_frame_interval_{0};
+  std::chrono::steady_clock::time_point last_preview_frame_time_;
+  PreviewStats preview_stats_;
 
   std::mutex mutex_;
 
   std::unique_ptr<CameraMethodChannel> camera_method_channel_;
   std::unique_ptr<DeviceMethodChannel> device_method_channel_;
+  std::unique_ptr<ImageStreamChannel> image_stream_channel_;
+  // Writes captured images so that the camera is not blocked by file I/O.
+  WorkerThread capture_writer_;
   std::unique_ptr<OrientationManager> orientation_manager_;
 
   camera_h camera_{nullptr};
@@ -348,6 +417,11 @@ class CameraDevice {
 
   int preview_width_{0};
   int preview_height_{0};
+  // The fps of the preview mode selected by SelectPreviewMode, to be restored
+  // when the preview frame rate limit is removed.
+  int preview_mode_fps_{CAMERA_ATTR_FPS_AUTO};
+  // The limit set by SetMaxPreviewFrameRate, or 0 if there is none.
+  double max_preview_frame_rate_{0};
 
   recorder_h recorder_{nullptr};
   RecorderState recorder_state_{RecorderState::kNone};
@@ -359,6 +433,7 @@ class CameraDevice {
   ResolutionPreset resolution_preset_{ResolutionPreset::kLow};
   std::vector<std::pair<int, int>> supported_camera_resolutions_;
   std::vector<std::pair<int, int>> supported_recorder_resolutions_;
+  std::unique_ptr<PreviewModeSelector> preview_mode_selector_;
 
   bool enable_audio_{true};
   bool is_preview_paused_{false};
@@ -40,3 +40,11 @@ void CameraMethodChannel::Send(
   }
   channel_->InvokeMethod(EventTypeToString(event_type), std::move(args));
 }
+
+void CameraMethodChannel::SetMethodCallHandler(
+    flutter::MethodCallHandler<flutter::EncodableValue> handler) {
+  if (!channel_) {
+    return;
+  }
+  channel_->SetMethodCallHandler(std::move(handler));
+}
@@ -23,6 +23,8 @@ class CameraMethodChannel {
                       long event_channel_Id);
   void Send(CameraEventType eventType,
             std::unique_ptr<flutter::EncodableValue>&& args);
+  void SetMethodCallHandler(
+      flutter::MethodCallHandler<flutter::EncodableValue> handler);
 
  private:
   std::unique_ptr<flutter::MethodChannel<flutter::EncodableValue>> channel_;
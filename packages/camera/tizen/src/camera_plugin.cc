@@ -28,6 +28,14 @@ bool GetValueFromEncodableMap(flutter::EncodableMap &map, std::string key,
   return false;
 }
 
+flutter::EncodableMap PreviewModeToEncodable(const PreviewMode &mode) {
+  return flutter::EncodableMap{
+      {flutter::EncodableValue("width"), flutter::EncodableValue(mode.width)},
+      {flutter::EncodableValue("height"), flutter::EncodableValue(mode.height)},
+      {flutter::EncodableValue("fps"), flutter::EncodableValue(mode.fps)},
+  };
+}
+
 class CameraPlugin : public flutter::Plugin {
  public:
   static void RegisterWithRegistrar(flutter::PluginRegistrar *registrar) {
@@ -122,6 +130,22 @@ class CameraPlugin : public flutter::Plugin {
       result->Error("InvalidArguments", "Please check 'imageFormatGroup'");
     } else if (method_name == "takePicture") {
       camera_->TakePicture(std::move(result));
+    } else if (method_name == "takeSnapshot") {
+      camera_->TakeSnapshot(std::move(result));
+    } else if (method_name == "takePictureBurst") {
+      if (method_call.arguments()) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        int count = 0;
+        int interval_ms = 0;
+        GetValueFromEncodableMap(arguments, "interval", interval_ms);
+        if (GetValueFromEncodableMap(arguments, "count", count) && count > 0 &&
+            interval_ms >= 0) {
+          camera_->TakePictureBurst(count, interval_ms, std::move(result));
+          return;
+        }
+      }
+      result->Error("InvalidArguments", "Please check 'count' and 'interval'");
     } else if (method_name == "prepareForVideoRecording") {
       result->NotImplemented();
     } else if (method_name == "startVideoRecording") {
@@ -245,10 +269,49 @@ class CameraPlugin : public flutter::Plugin {
         }
       }
       result->Error("InvalidArguments", "Please check arguments(reset or x,y");
+    } else if (method_name == "getSupportedPreviewModes") {
+      flutter::EncodableList modes;
+      for (const PreviewMode &mode : camera_->GetSupportedPreviewModes()) {
+        modes.push_back(flutter::EncodableValue(PreviewModeToEncodable(mode)));
+      }
+      result->Success(flutter::EncodableValue(modes));
+    } else if (method_name == "selectPreviewMode") {
+      if (method_call.arguments()) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        PreviewModeRequest request;
+        GetValueFromEncodableMap(arguments, "width", request.width);
+        GetValueFromEncodableMap(arguments, "height", request.height);
+        GetValueFromEncodableMap(arguments, "fps", request.fps);
+        GetValueFromEncodableMap(arguments, "aspectRatio",
+                                 request.aspect_ratio);
+        try {
+          PreviewMode mode = camera_->SelectPreviewMode(request);
+          result->Success(
+              flutter::EncodableValue(PreviewModeToEncodable(mode)));
+        } catch (const CameraDeviceError &error) {
+          result->Error(error.GetErrorCode(), error.GetErrorMessage());
+        }
+        return;
+      }
+      result->Error("InvalidArguments", "Please check arguments");
     } else if (method_name == "startImageStream") {
-      result->NotImplemented();
+      double max_frame_rate = 0;
+      if (method_call.arguments() &&
+          std::holds_alternative<flutter::EncodableMap>(
+              *method_call.arguments())) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        GetValueFromEncodableMap(arguments, "maxFrameRate", max_frame_rate);
+      }
+      camera_->StartImageStream(max_frame_rate);
+      result->Success();
     } else if (method_name == "stopImageStream") {
-      result->NotImplemented();
+      camera_->StopImageStream();
+      result->Success();
+    } else if (method_name == "receivedImageStreamData") {
+      camera_->OnImageStreamFrameReceived();
+      result->Success();
     } else if (method_name == "getMaxZoomLevel") {
       try {
         float max = camera_->GetMaxZoomLevel();
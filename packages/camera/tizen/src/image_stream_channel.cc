@@ -0,0 +1,170 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "image_stream_channel.h"
+
+#include <camera.h>
+#include <flutter/event_stream_handler_functions.h>
+#include <flutter/standard_method_codec.h>
+#include <tbm_surface.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log.h"
+#include "worker_thread.h"
+
+namespace {
+
+constexpr char kChannelName[] = "plugins.flutter.io/camera_tizen/imageStream";
+
+// Copies the planes of the frame in |packet| as they are laid out in memory,
+// without converting them.
+bool EncodeFrame(media_packet_h packet, flutter::EncodableMap &frame) {
+  tbm_surface_h surface = nullptr;
+  int error = media_packet_get_tbm_surface(packet, &surface);
+  RETV_LOG_ERROR_IF(error != MEDIA_PACKET_ERROR_NONE || !surface, false,
+                    "media_packet_get_tbm_surface fail - error[%d]", error);
+
+  tbm_surface_info_s info;
+  error = tbm_surface_map(surface, TBM_SURF_OPTION_READ, &info);
+  RETV_LOG_ERROR_IF(error != TBM_SURFACE_ERROR_NONE, false,
+                    "tbm_surface_map fail - error[%d]", error);
+
+  int format = CAMERA_PIXEL_FORMAT_INVALID;
+  int chroma_pixel_size = 1;
+  switch (info.format) {
+    case TBM_FORMAT_NV12:
+      format = CAMERA_PIXEL_FORMAT_NV12;
+      chroma_pixel_size = 2;
+      break;
+    case TBM_FORMAT_NV21:
+      format = CAMERA_PIXEL_FORMAT_NV21;
+      chroma_pixel_size = 2;
+      break;
+    case TBM_FORMAT_YUV420:
+      format = CAMERA_PIXEL_FORMAT_I420;
+      break;
+    default:
+      LOG_ERROR("Unsupported preview format[%u]", info.format);
+      tbm_surface_unmap(surface);
+      return false;
+  }
+
+  flutter::EncodableList planes;
+  for (uint32_t i = 0; i < info.num_planes; i++) {
+    const tbm_surface_plane_s &plane = info.planes[i];
+    // Chroma planes are subsampled by 2 in both directions.
+    int width = i == 0 ? info.width : (info.width + 1) / 2;
+    int height = i == 0 ? info.height : (info.height + 1) / 2;
+    size_t size = std::min<size_t>(
+        plane.size, static_cast<size_t>(plane.stride) * height);
+    planes.push_back(flutter::EncodableValue(flutter::EncodableMap{
+        {flutter::EncodableValue("bytes"),
+         flutter::EncodableValue(
+             std::vector<uint8_t>(plane.ptr, plane.ptr + size))},
+        {flutter::EncodableValue("bytesPerRow"),
+         flutter::EncodableValue(static_cast<int>(plane.stride))},
+        {flutter::EncodableValue("bytesPerPixel"),
+         flutter::EncodableValue(i == 0 ? 1 : chroma_pixel_size)},
+        {flutter::EncodableValue("width"), flutter::EncodableValue(width)},
+        {flutter::EncodableValue("height"), flutter::EncodableValue(height)},
+    }));
+  }
+  tbm_surface_unmap(surface);
+
+  frame[flutter::EncodableValue("format")] = flutter::EncodableValue(format);
+  frame[flutter::EncodableValue("width")] =
+      flutter::EncodableValue(static_cast<int>(info.width));
+  frame[flutter::EncodableValue("height")] =
+      flutter::EncodableValue(static_cast<int>(info.height));
+  frame[flutter::EncodableValue("planes")] =
+      flutter::EncodableValue(std::move(planes));
+  return true;
+}
+
+}  // namespace
+
+ImageStreamChannel::ImageStreamChannel(flutter::PluginRegistrar *registrar) {
+  channel_ = std::make_unique<flutter::EventChannel<flutter::EncodableValue>>(
+      registrar->messenger(), kChannelName,
+      &flutter::StandardMethodCodec::GetInstance());
+  auto handler = std::make_unique<
+      flutter::StreamHandlerFunctions<flutter::EncodableValue>>(
+      [this](const flutter::EncodableValue *arguments,
+             std::unique_ptr<EventSink> &&events)
+          -> std::unique_ptr<flutter::StreamHandlerError<>> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sink_ = std::move(events);
+        return nullptr;
+      },
+      [this](const flutter::EncodableValue *arguments)
+          -> std::unique_ptr<flutter::StreamHandlerError<>> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sink_ = nullptr;
+        return nullptr;
+      });
+  channel_->SetStreamHandler(std::move(handler));
+}
+
+ImageStreamChannel::~ImageStreamChannel() {
+  channel_->SetStreamHandler(nullptr);
+}
+
+void ImageStreamChannel::Start(double max_frame_rate) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  is_streaming_ = true;
+  is_frame_pending_ = false;
+  if (max_frame_rate > 0) {
+    min_frame_interval_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / max_frame_rate));
+  } else {
+    min_frame_interval_ = Clock::duration::zero();
+  }
+  last_frame_time_ = Clock::time_point();
+}
+
+void ImageStreamChannel::Stop() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  is_streaming_ = false;
+  is_frame_pending_ = false;
+}
+
+void ImageStreamChannel::OnPreviewFrame(const SharedMediaPacket &packet) {
+  std::weak_ptr<EventSink> sink;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_streaming_ || !sink_ || is_frame_pending_) {
+      return;
+    }
+    Clock::time_point now = Clock::now();
+    if (now - last_frame_time_ < min_frame_interval_) {
+      return;
+    }
+    is_frame_pending_ = true;
+    last_frame_time_ = now;
+    sink = sink_;
+  }
+
+  RunOnPlatformThread([this, sink, packet]() {
+    std::shared_ptr<EventSink> events = sink.lock();
+    if (!events) {
+      return;
+    }
+    flutter::EncodableMap frame;
+    if (!EncodeFrame(packet.get(), frame)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_frame_pending_ = false;
+      return;
+    }
+    events->Success(flutter::EncodableValue(std::move(frame)));
+  });
+}
+
+void ImageStreamChannel::OnFrameReceived() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  is_frame_pending_ = false;
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_IMAGE_STREAM_CHANNEL_H_
+#define FLUTTER_PLUGIN_IMAGE_STREAM_CHANNEL_H_
+
+#include <flutter/encodable_value.h>
+#include <flutter/event_channel.h>
+#include <flutter/plugin_registrar.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "shared_media_packet.h"
+
+// Sends camera preview frames to the image stream of the Dart side.
+//
+// A frame is only sent after the previous one has been received by Dart, and
+// at most at the maximum frame rate given to Start(). Other frames are
+// dropped before their planes are copied. The planes of a frame that is sent
+// are copied once, on the platform thread, directly into the message.
+class ImageStreamChannel {
+ public:
+  explicit ImageStreamChannel(flutter::PluginRegistrar *registrar);
+  ~ImageStreamChannel();
+
+  // Starts streaming. A |max_frame_rate| of 0 means no limit.
+  void Start(double max_frame_rate);
+  void Stop();
+
+  // Called on the camera thread for every preview frame. A reference to
+  // |packet| is kept until its planes have been copied.
+  void OnPreviewFrame(const SharedMediaPacket &packet);
+
+  // Called when Dart has received the last frame sent.
+  void OnFrameReceived();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  using EventSink = flutter::EventSink<flutter::EncodableValue>;
+
+  std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> channel_;
+
+  std::mutex mutex_;
+  // Shared with the frames posted to the platform thread, which are dropped
+  // if the stream has been cancelled in the meantime.
+  std::shared_ptr<EventSink> sink_;
+  bool is_streaming_{false};
+  bool is_frame_pending_{false};
+  Clock::duration min_frame_interval_{0};
+  Clock::time_point last_frame_time_;
+};
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_mode_selector.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Modes within 5% of the requested aspect ratio are accepted.
+constexpr double kAspectRatioTolerance = 0.05;
+
+// The extra cost of a mode that has to be scaled while recording.
+constexpr double kScalingPenalty = 1.25;
+
+// Assumed for modes of which the frame rates are unknown.
+constexpr int kDefaultFps = 30;
+
+int LongSide(int width, int height) { return std::max(width, height); }
+
+int ShortSide(int width, int height) { return std::min(width, height); }
+
+bool SatisfiesSize(const PreviewMode &mode, const PreviewModeRequest &request) {
+  return LongSide(mode.width, mode.height) >=
+             LongSide(request.width, request.height) &&
+         ShortSide(mode.width, mode.height) >=
+             ShortSide(request.width, request.height);
+}
+
+bool SatisfiesFps(const PreviewMode &mode, const PreviewModeRequest &request) {
+  return mode.fps == 0 || mode.fps >= request.fps;
+}
+
+bool SatisfiesAspectRatio(const PreviewMode &mode,
+                          const PreviewModeRequest &request) {
+  if (request.aspect_ratio <= 0) {
+    return true;
+  }
+  int short_side = ShortSide(mode.width, mode.height);
+  if (short_side <= 0) {
+    return false;
+  }
+  double aspect_ratio =
+      static_cast<double>(LongSide(mode.width, mode.height)) / short_side;
+  return std::abs(aspect_ratio - request.aspect_ratio) <=
+         request.aspect_ratio * kAspectRatioTolerance;
+}
+
+}  // namespace
+
+PreviewModeSelector::PreviewModeSelector(
+    std::vector<PreviewMode> modes,
+    std::vector<std::pair<int, int>> recorder_resolutions)
+    : modes_(std::move(modes)),
+      recorder_resolutions_(std::move(recorder_resolutions)) {}
+
+std::optional<PreviewMode> PreviewModeSelector::Select(
+    const PreviewModeRequest &request) const {
+  const PreviewMode *best = nullptr;
+  auto select = [&](bool check_size, bool check_aspect_ratio) {
+    for (const PreviewMode &mode : modes_) {
+      if (check_aspect_ratio && !SatisfiesAspectRatio(mode, request)) {
+        continue;
+      }
+      if (check_size) {
+        // The cheapest mode that is large and fast enough.
+        if (SatisfiesSize(mode, request) && SatisfiesFps(mode, request) &&
+            (!best || Cost(mode) < Cost(*best))) {
+          best = &mode;
+        }
+      } else if (!best || Cost(mode) > Cost(*best)) {
+        // The largest and fastest mode.
+        best = &mode;
+      }
+    }
+    return best != nullptr;
+  };
+  if (select(true, true) || select(true, false) || select(false, true) ||
+      select(false, false)) {
+    return *best;
+  }
+  return std::nullopt;
+}
+
+double PreviewModeSelector::Cost(const PreviewMode &mode) const {
+  double cost = static_cast<double>(mode.width) * mode.height *
+                (mode.fps > 0 ? mode.fps : kDefaultFps);
+  auto iter = std::find_if(recorder_resolutions_.begin(),
+                           recorder_resolutions_.end(),
+                           [&mode](const std::pair<int, int> &resolution) {
+                             return resolution.first == mode.width &&
+                                    resolution.second == mode.height;
+                           });
+  if (iter == recorder_resolutions_.end()) {
+    cost *= kScalingPenalty;
+  }
+  return cost;
+}
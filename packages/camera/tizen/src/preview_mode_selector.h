@@ -0,0 +1,56 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_PREVIEW_MODE_SELECTOR_H_
+#define FLUTTER_PLUGIN_PREVIEW_MODE_SELECTOR_H_
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+struct PreviewMode {
+  int width{0};
+  int height{0};
+  // 0 if the camera does not report the frame rates of this resolution.
+  int fps{0};
+};
+
+// The requirements of a preview mode. A value of 0 means no requirement.
+//
+// Sizes are compared regardless of orientation, i.e. a 480x640 request is
+// satisfied by a 640x480 mode.
+struct PreviewModeRequest {
+  int width{0};
+  int height{0};
+  int fps{0};
+  // The ratio of the long side to the short side.
+  double aspect_ratio{0};
+};
+
+// Chooses the cheapest preview mode of a camera that satisfies a request.
+//
+// The cost of a mode is the number of pixels it produces per second. Modes
+// whose size is not a recorder video resolution cost more, since frames then
+// have to be scaled while recording.
+class PreviewModeSelector {
+ public:
+  PreviewModeSelector(std::vector<PreviewMode> modes,
+                      std::vector<std::pair<int, int>> recorder_resolutions);
+
+  const std::vector<PreviewMode> &modes() const { return modes_; }
+
+  // Returns the cheapest mode satisfying |request|. If no mode satisfies
+  // the aspect ratio, the aspect ratio is ignored. If no mode is large or
+  // fast enough, returns the largest and fastest mode, preferably of the
+  // requested aspect ratio. Returns nullopt only if there is no mode at all.
+  std::optional<PreviewMode> Select(const PreviewModeRequest &request) const;
+
+ private:
+  double Cost(const PreviewMode &mode) const;
+
+  std::vector<PreviewMode> modes_;
+  std::vector<std::pair<int, int>> recorder_resolutions_;
+};
+
+#endif
@@ -0,0 +1,116 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_snapshot.h"
+
+#include <image_util.h>
+#include <tbm_surface.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "log.h"
+
+namespace {
+
+// Copies |rows| rows of |row_size| bytes from |plane|, skipping the padding at
+// the end of its rows, to the end of |out|.
+void AppendPlane(const tbm_surface_plane_s &plane, size_t row_size,
+                 size_t rows, std::vector<unsigned char> &out) {
+  size_t offset = out.size();
+  out.resize(offset + row_size * rows);
+  size_t copy_size = std::min<size_t>(row_size, plane.stride);
+  for (size_t row = 0; row < rows; row++) {
+    size_t start = row * plane.stride;
+    if (start + copy_size > plane.size) {
+      break;
+    }
+    std::memcpy(out.data() + offset + row * row_size, plane.ptr + start,
+                copy_size);
+  }
+}
+
+// Packs the planes of a mapped NV12, NV21 or I420 surface without row
+// padding, as expected by image_util.
+bool PackSurface(const tbm_surface_info_s &info,
+                 image_util_colorspace_e &colorspace,
+                 std::vector<unsigned char> &out) {
+  size_t width = info.width;
+  size_t height = info.height;
+  size_t chroma_width = (width + 1) / 2;
+  size_t chroma_height = (height + 1) / 2;
+  switch (info.format) {
+    case TBM_FORMAT_NV12:
+    case TBM_FORMAT_NV21:
+      if (info.num_planes < 2) {
+        return false;
+      }
+      colorspace = info.format == TBM_FORMAT_NV12
+                       ? IMAGE_UTIL_COLORSPACE_NV12
+                       : IMAGE_UTIL_COLORSPACE_NV21;
+      out.reserve(width * height + chroma_width * 2 * chroma_height);
+      AppendPlane(info.planes[0], width, height, out);
+      AppendPlane(info.planes[1], chroma_width * 2, chroma_height, out);
+      return true;
+    case TBM_FORMAT_YUV420:
+      if (info.num_planes < 3) {
+        return false;
+      }
+      colorspace = IMAGE_UTIL_COLORSPACE_I420;
+      out.reserve(width * height + chroma_width * chroma_height * 2);
+      AppendPlane(info.planes[0], width, height, out);
+      AppendPlane(info.planes[1], chroma_width, chroma_height, out);
+      AppendPlane(info.planes[2], chroma_width, chroma_height, out);
+      return true;
+    default:
+      LOG_ERROR("Unsupported preview format[%u]", info.format);
+      return false;
+  }
+}
+
+}  // namespace
+
+bool WritePreviewSnapshot(SharedMediaPacket packet, const std::string &path) {
+  tbm_surface_h surface = nullptr;
+  int error = media_packet_get_tbm_surface(packet.get(), &surface);
+  RETV_LOG_ERROR_IF(error != MEDIA_PACKET_ERROR_NONE || !surface, false,
+                    "media_packet_get_tbm_surface fail - error[%d]", error);
+
+  tbm_surface_info_s info;
+  error = tbm_surface_map(surface, TBM_SURF_OPTION_READ, &info);
+  RETV_LOG_ERROR_IF(error != TBM_SURFACE_ERROR_NONE, false,
+                    "tbm_surface_map fail - error[%d]", error);
+  image_util_colorspace_e colorspace;
+  std::vector<unsigned char> data;
+  bool is_packed = PackSurface(info, colorspace, data);
+  tbm_surface_unmap(surface);
+  packet = nullptr;
+  if (!is_packed) {
+    return false;
+  }
+
+  image_util_image_h image = nullptr;
+  error = image_util_create_image(info.width, info.height, colorspace,
+                                  data.data(), data.size(), &image);
+  RETV_LOG_ERROR_IF(error != IMAGE_UTIL_ERROR_NONE, false,
+                    "image_util_create_image fail - error[%d]: %s", error,
+                    get_error_message(error));
+
+  image_util_encode_h encoder = nullptr;
+  error = image_util_encode_create(IMAGE_UTIL_JPEG, &encoder);
+  if (error != IMAGE_UTIL_ERROR_NONE) {
+    LOG_ERROR("image_util_encode_create fail - error[%d]: %s", error,
+              get_error_message(error));
+    image_util_destroy_image(image);
+    return false;
+  }
+  error = image_util_encode_run_to_file(encoder, image, path.c_str());
+  LOG_ERROR_IF(error != IMAGE_UTIL_ERROR_NONE,
+               "image_util_encode_run_to_file fail - error[%d]: %s", error,
+               get_error_message(error));
+  image_util_encode_destroy(encoder);
+  image_util_destroy_image(image);
+  return error == IMAGE_UTIL_ERROR_NONE;
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_PREVIEW_SNAPSHOT_H_
+#define FLUTTER_PLUGIN_PREVIEW_SNAPSHOT_H_
+
+#include <string>
+
+#include "shared_media_packet.h"
+
+// Encodes the preview frame in |packet| to a JPEG file at |path|. The
+// reference to |packet| is released as soon as its planes have been read, so
+// that the camera can reuse the buffer during the encoding.
+//
+// Unlike a capture, this does not interrupt the preview or a recording, but
+// the image has the preview resolution and is not rotated.
+bool WritePreviewSnapshot(SharedMediaPacket packet, const std::string &path);
+
+#endif
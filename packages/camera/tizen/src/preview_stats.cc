@@ -0,0 +1,48 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_stats.h"
+
+#include <algorithm>
+#include <vector>
+
+void PreviewStats::OnFramePresented(Clock::time_point delivered_at) {
+  int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                        Clock::now() - delivered_at)
+                        .count();
+  latencies_[frames_presented_ % kLatencySamples] = latency;
+  latency_count_ = std::min(latency_count_ + 1, kLatencySamples);
+  frames_presented_++;
+}
+
+void PreviewStats::Reset() { *this = PreviewStats(); }
+
+flutter::EncodableMap PreviewStats::ToEncodableMap() const {
+  std::vector<int64_t> latencies(latencies_.begin(),
+                                 latencies_.begin() + latency_count_);
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](size_t percent) -> int64_t {
+    if (latencies.empty()) {
+      return 0;
+    }
+    return latencies[(latencies.size() - 1) * percent / 100];
+  };
+
+  return flutter::EncodableMap{
+      {flutter::EncodableValue("framesDelivered"),
+       flutter::EncodableValue(frames_delivered_)},
+      {flutter::EncodableValue("framesDropped"),
+       flutter::EncodableValue(frames_dropped_)},
+      {flutter::EncodableValue("framesReplaced"),
+       flutter::EncodableValue(frames_replaced_)},
+      {flutter::EncodableValue("framesPresented"),
+       flutter::EncodableValue(frames_presented_)},
+      {flutter::EncodableValue("latencyP50"),
+       flutter::EncodableValue(percentile(50))},
+      {flutter::EncodableValue("latencyP90"),
+       flutter::EncodableValue(percentile(90))},
+      {flutter::EncodableValue("latencyP99"),
+       flutter::EncodableValue(percentile(99))},
+  };
+}
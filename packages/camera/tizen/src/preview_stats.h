@@ -0,0 +1,55 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_PREVIEW_STATS_H_
+#define FLUTTER_PLUGIN_PREVIEW_STATS_H_
+
+#include <flutter/encodable_value.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Counts what happens to the preview frames delivered by the camera, and
+// how long they wait before being presented by the texture.
+//
+// Not thread-safe. The owner must serialize all calls.
+class PreviewStats {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // A frame was delivered by the camera.
+  void OnFrameDelivered() { frames_delivered_++; }
+
+  // A delivered frame was dropped because the preview is paused or over the
+  // maximum frame rate.
+  void OnFrameDropped() { frames_dropped_++; }
+
+  // A frame was replaced by a newer one before being presented.
+  void OnFrameReplaced() { frames_replaced_++; }
+
+  // A frame delivered at |delivered_at| was handed to the texture.
+  void OnFramePresented(Clock::time_point delivered_at);
+
+  void Reset();
+
+  // Returns the counters and the latency percentiles in microseconds of the
+  // most recently presented frames.
+  flutter::EncodableMap ToEncodableMap() const;
+
+ private:
+  static constexpr size_t kLatencySamples = 256;
+
+  int64_t frames_delivered_{0};
+  int64_t frames_dropped_{0};
+  int64_t frames_replaced_{0};
+  int64_t frames_presented_{0};
+
+  // A ring of the latest latencies in microseconds.
+  std::array<int64_t, kLatencySamples> latencies_{};
+  size_t latency_count_{0};
+};
+
+#endif
@@ -0,0 +1,27 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_SHARED_MEDIA_PACKET_H_
+#define FLUTTER_PLUGIN_SHARED_MEDIA_PACKET_H_
+
+#include <media_packet.h>
+
+#include <memory>
+#include <type_traits>
+
+// A media packet shared by several consumers, e.g. a preview frame that is
+// presented by the texture while being sent to the image stream. The packet
+// is destroyed when the last reference is released.
+//
+// Note that the camera has a limited number of preview buffers, so
+// references must not be held longer than needed.
+using SharedMediaPacket =
+    std::shared_ptr<std::remove_pointer_t<media_packet_h>>;
+
+// Takes the ownership of |packet|.
+inline SharedMediaPacket MakeSharedMediaPacket(media_packet_h packet) {
+  return SharedMediaPacket(packet, media_packet_destroy);
+}
+
+#endif
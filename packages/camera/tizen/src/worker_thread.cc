@@ -0,0 +1,63 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "worker_thread.h"
+
+#include <Ecore.h>
+
+#include <exception>
+#include <utility>
+
+#include "log.h"
+
+void RunOnPlatformThread(std::function<void()> task) {
+  ecore_main_loop_thread_safe_call_async(
+      [](void *data) {
+        auto *task = static_cast<std::function<void()> *>(data);
+        (*task)();
+        delete task;
+      },
+      new std::function<void()>(std::move(task)));
+}
+
+WorkerThread::WorkerThread() {
+  thread_ = std::thread(&WorkerThread::Run, this);
+}
+
+WorkerThread::~WorkerThread() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_one();
+  thread_.join();
+}
+
+void WorkerThread::PostTask(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void WorkerThread::Run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    try {
+      task();
+    } catch (const std::exception &exception) {
+      LOG_ERROR("Uncaught exception in worker task: %s", exception.what());
+    }
+  }
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_WORKER_THREAD_H_
+#define FLUTTER_PLUGIN_WORKER_THREAD_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Runs |task| on the platform thread. Can be called from any thread.
+void RunOnPlatformThread(std::function<void()> task);
+
+// A serial task queue backed by a dedicated thread.
+//
+// Tasks run one at a time in the order they were posted. Tasks that are
+// still pending when the worker is destroyed are run before the thread exits.
+class WorkerThread {
+ public:
+  WorkerThread();
+  ~WorkerThread();
+
+  WorkerThread(const WorkerThread &) = delete;
+  WorkerThread &operator=(const WorkerThread &) = delete;
+
+  void PostTask(std::function<void()> task);
+
+ private:
+  void Run();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopped_{false};
+  std::thread thread_;
+};
+
+#endif
@@ -3,13 +3,18 @@
 // BSD-style license that can be found in the LICENSE file.
 
 import 'dart:io';
+import 'dart:typed_data';
 
+import 'package:flutter/services.dart';
 import 'package:flutter_test/flutter_test.dart';
 // ignore: import_of_legacy_library_into_null_safe
 import 'package:integration_test/integration_test.dart';
 import 'package:path/path.dart';
 import 'package:pedantic/pedantic.dart';
 import 'package:sqflite/sqflite.dart';
+import 'package:sqflite/src/database_mixin.dart' // ignore: implementation_imports
+    show
+        SqfliteDatabaseMixin;
 
 // ignore_for_file: avoid_print
 void main() {
@@ -254,6 +259,157 @@ void main() {
       await db.close();
     });
 
+    test('query cursor', () async {
+      final db = await openDatabase(inMemoryDatabasePath);
+      try {
+        await db.execute('CREATE TABLE test (id INTEGER PRIMARY KEY)');
+        final batch = db.batch();
+        for (var i = 1; i <= 10; i++) {
+          batch.insert('test', {'id': i});
+        }
+        await batch.commit(noResult: true);
+
+        final cursor = await db.rawQueryCursor(
+          'SELECT id FROM test ORDER BY id',
+          null,
+          bufferSize: 3,
+        );
+        final ids = <Object?>[];
+        while (await cursor.moveNext()) {
+          ids.add(cursor.current['id']);
+        }
+        expect(ids, List.generate(10, (i) => i + 1));
+
+        // Closing a cursor before reaching the end releases it.
+        final partial = await db.rawQueryCursor(
+          'SELECT id FROM test ORDER BY id',
+          null,
+          bufferSize: 2,
+        );
+        expect(await partial.moveNext(), isTrue);
+        expect(partial.current['id'], 1);
+        await partial.close();
+        expect(await db.rawQuery('SELECT COUNT(*) AS c FROM test'), [
+          {'c': 10},
+        ]);
+      } finally {
+        await db.close();
+      }
+    });
+
+    test('wal readers', () async {
+      const channel = MethodChannel('com.tekartik.sqflite');
+      const path = 'test_wal_readers.db';
+      await deleteDatabase(path);
+      await channel.invokeMethod('options', {'walReaderCount': 2});
+      final db = await openDatabase(path);
+      await channel.invokeMethod('options', {'walReaderCount': 0});
+      try {
+        expect(await db.rawQuery('PRAGMA journal_mode'), [
+          {'journal_mode': 'wal'},
+        ]);
+        await db.execute('CREATE TABLE test (id INTEGER PRIMARY KEY)');
+        for (var i = 1; i <= 3; i++) {
+          await db.insert('test', {'id': i});
+          // Reads see the writes made before them.
+          expect(await db.rawQuery('SELECT COUNT(*) AS c FROM test'), [
+            {'c': i},
+          ]);
+        }
+        await db.transaction((txn) async {
+          await txn.insert('test', {'id': 4});
+          expect(await txn.rawQuery('SELECT COUNT(*) AS c FROM test'), [
+            {'c': 4},
+          ]);
+        });
+        final counts = await Future.wait(
+          List.generate(
+            8,
+            (_) => db.rawQuery('SELECT COUNT(*) AS c FROM test'),
+          ),
+        );
+        for (final count in counts) {
+          expect(count, [
+            {'c': 4},
+          ]);
+        }
+      } finally {
+        await db.close();
+      }
+    });
+
+    test('profile', () async {
+      const channel = MethodChannel('com.tekartik.sqflite');
+      final db = await openDatabase(inMemoryDatabasePath);
+      try {
+        await channel.invokeMethod('debug', {
+          'cmd': 'profile',
+          'enabled': true,
+        });
+        await db.execute('CREATE TABLE test (id INTEGER PRIMARY KEY)');
+        for (var i = 1; i <= 3; i++) {
+          await db.insert('test', {'id': i});
+        }
+        await db.rawQuery('SELECT id FROM test');
+
+        final result = (await channel.invokeMethod<Map>('debug', {
+          'cmd': 'profile',
+          'enabled': false,
+          'reset': true,
+        }))!;
+        expect(result['enabled'], isFalse);
+        final profile = (result['databases'] as Map).values.single as Map;
+        final statements = {
+          for (final statement in profile['statements'] as List)
+            (statement as Map)['sql']: statement,
+        };
+        expect(statements['INSERT INTO test (id) VALUES (?)']['count'], 3);
+        expect(statements['SELECT id FROM test']['rows'], 3);
+        expect(profile['slowest'], isNotEmpty);
+      } finally {
+        await db.close();
+      }
+    });
+
+    test('blob io', () async {
+      const channel = MethodChannel('com.tekartik.sqflite');
+      final db = await openDatabase(inMemoryDatabasePath);
+      try {
+        final id = (db as SqfliteDatabaseMixin).id;
+        await db.execute(
+          'CREATE TABLE test (id INTEGER PRIMARY KEY, data BLOB)',
+        );
+        final rowId = await db.rawInsert(
+          'INSERT INTO test (data) VALUES (zeroblob(1000))',
+        );
+        final blob = (await channel.invokeMethod<Map>('blobOpen', {
+          'id': id,
+          'table': 'test',
+          'column': 'data',
+          'rowId': rowId,
+          'writable': true,
+        }))!;
+        expect(blob['size'], 1000);
+        final blobId = blob['blobId'];
+        await channel.invokeMethod('blobWrite', {
+          'id': id,
+          'blobId': blobId,
+          'offset': 998,
+          'data': Uint8List.fromList([1, 2]),
+        });
+        final data = await channel.invokeMethod<Uint8List>('blobRead', {
+          'id': id,
+          'blobId': blobId,
+          'offset': 996,
+          'length': 10,
+        });
+        expect(data, [0, 0, 1, 2]);
+        await channel.invokeMethod('blobClose', {'id': id, 'blobId': blobId});
+      } finally {
+        await db.close();
+      }
+    });
+
     test('deleteDatabase', () async {
       // await devVerbose();
       late Database db;
@@ -73,6 +73,24 @@ class SlowTestPage extends TestPage {
       await db.close();
     });
 
+    test('Perf 10000 insert batch', () async {
+      final path = await initDeleteDb('slow_10000_insert_batch.db');
+      final db = await openDatabase(path);
+      await db.execute('CREATE TABLE Test (id INTEGER PRIMARY KEY, name TEXT)');
+
+      // Batch.apply does not open a transaction on the Dart side, so this
+      // measures the native batch execution as is.
+      final sw = Stopwatch()..start();
+      final batch = db.batch();
+      for (var i = 0; i < 10000; i++) {
+        batch.rawInsert('INSERT INTO Test (name) VALUES (?)', ['item $i']);
+      }
+      final results = await batch.apply();
+      expect(results.length, 10000);
+      print('10000 insert batch apply ${sw.elapsed}');
+      await db.close();
+    });
+
     const count = 10000;
 
     test('Perf $count item', () async {
@@ -80,6 +98,24 @@ class SlowTestPage extends TestPage {
       await perfDo(count);
     });
 
+    for (final rowCount in [10000, 100000]) {
+      test('Perf query $rowCount rows', () async {
+        await perfQuery(rowCount);
+      });
+    }
+
+    test('Perf 100 open', () async {
+      await perfOpen(100);
+    });
+
+    test('Perf narrow/wide query', () async {
+      await perfColumns(10000);
+    });
+
+    test('Perf blob round-trip', () async {
+      await perfBlob();
+    });
+
     if (platform.isAndroid) {
       test('Perf android NORMAL_PRIORITY', () async {
         // ignore_for_file: deprecated_member_use, deprecated_member_use_from_same_package
@@ -143,6 +179,118 @@ class SlowTestPage extends TestPage {
     }
   }
 
+  /// Query perf testing, reading [count] rows of mixed column types.
+  Future perfQuery(int count) async {
+    final path = await initDeleteDb('perf_query_$count.db');
+    final db = await openDatabase(path);
+    try {
+      await db.execute(
+        'CREATE TABLE Test (id INTEGER PRIMARY KEY, name TEXT, value REAL, '
+        'data BLOB)',
+      );
+      final batch = db.batch();
+      final data = Uint8List.fromList(List.generate(64, (i) => i));
+      for (var i = 0; i < count; i++) {
+        batch.rawInsert(
+          'INSERT INTO Test (name, value, data) VALUES (?, ?, ?)',
+          ['item $i', i / 3, data],
+        );
+      }
+      await batch.commit(noResult: true);
+
+      Future<void> timeQuery(String label) async {
+        final sw = Stopwatch()..start();
+        final result = await db.rawQuery('SELECT * FROM Test');
+        final elapsed = sw.elapsed;
+        expect(result.length, count);
+        final rowsPerSecond =
+            (count * Duration.microsecondsPerSecond / elapsed.inMicroseconds)
+                .round();
+        print('sw $elapsed $label $count rows, $rowsPerSecond rows/s');
+      }
+
+      await timeQuery('columns/rows');
+      await Sqflite.devSetOptions(SqfliteOptions()..queryAsMapList = true);
+      try {
+        await timeQuery('map list');
+      } finally {
+        await Sqflite.devSetOptions(SqfliteOptions()..queryAsMapList = false);
+      }
+    } finally {
+      await db.close();
+    }
+  }
+
+  /// Open/close perf testing.
+  Future perfOpen(int count) async {
+    final path = await initDeleteDb('perf_open.db');
+    final db = await openDatabase(path, version: 1);
+    await db.close();
+
+    final sw = Stopwatch()..start();
+    for (var i = 0; i < count; i++) {
+      final db = await openDatabase(path);
+      await db.close();
+    }
+    print('sw ${sw.elapsed} open/close $count times');
+  }
+
+  /// Query perf testing, reading [count] rows of 1 and 20 columns.
+  Future perfColumns(int count) async {
+    final path = await initDeleteDb('perf_columns.db');
+    final db = await openDatabase(path);
+    try {
+      const columnCount = 20;
+      final columns = List.generate(columnCount, (i) => 'c$i');
+      await db.execute(
+        'CREATE TABLE Test (id INTEGER PRIMARY KEY, '
+        '${columns.map((column) => '$column TEXT').join(', ')})',
+      );
+      final batch = db.batch();
+      for (var i = 0; i < count; i++) {
+        batch.insert('Test', {
+          for (final column in columns) column: '$column $i',
+        });
+      }
+      await batch.commit(noResult: true);
+
+      for (final selection in ['id', '*']) {
+        final sw = Stopwatch()..start();
+        final result = await db.rawQuery('SELECT $selection FROM Test');
+        expect(result.length, count);
+        print('sw ${sw.elapsed} SELECT $selection FROM Test $count rows');
+      }
+    } finally {
+      await db.close();
+    }
+  }
+
+  /// Blob perf testing, writing and reading back blobs of various sizes.
+  Future perfBlob() async {
+    final path = await initDeleteDb('perf_blob.db');
+    final db = await openDatabase(path);
+    try {
+      await db.execute('CREATE TABLE Test (id INTEGER PRIMARY KEY, data BLOB)');
+      for (final size in [1024, 64 * 1024, 1024 * 1024, 8 * 1024 * 1024]) {
+        final data = Uint8List.fromList(List.generate(size, (i) => i & 0xff));
+        final sw = Stopwatch()..start();
+        final id = await db.insert('Test', {'data': data});
+        final written = sw.elapsed;
+        final result = await db.query(
+          'Test',
+          columns: ['data'],
+          where: 'id = ?',
+          whereArgs: [id],
+        );
+        final read = sw.elapsed - written;
+        expect((result.first['data'] as Uint8List).length, size);
+        print('sw blob $size bytes write $written read $read');
+      }
+    } finally {
+      await db.close();
+    }
+  }
+
   /// Insert perf testing.
   Future perfInsert() async {
     final path = await initDeleteDb('slow_txn_1000_insert.db');
@@ -18,6 +18,12 @@ const std::string kMethodUpdate = "update";
 const std::string kMethodBatch = "batch";
 const std::string kMethodDeleteDatabase = "deleteDatabase";
 const std::string kMethodDatabaseExists = "databaseExists";
+const std::string kMethodQueryCursorNext = "queryCursorNext";
+// Tizen only
+const std::string kMethodBlobOpen = "blobOpen";
+const std::string kMethodBlobRead = "blobRead";
+const std::string kMethodBlobWrite = "blobWrite";
+const std::string kMethodBlobClose = "blobClose";
 const std::string kParamId = "id";
 const std::string kParamPath = "path";
 
@@ -26,6 +32,21 @@ const std::string kParamReadOnly = "readOnly";              // boolean
 const std::string kParamSingleInstance = "singleInstance";  // boolean
 const std::string kParamLogLevel = "logLevel";              // int
 
+// blob methods, Tizen only
+const std::string kParamTable = "table";
+const std::string kParamColumn = "column";
+const std::string kParamRowId = "rowId";
+const std::string kParamWritable = "writable";  // boolean
+const std::string kParamBlobId = "blobId";
+const std::string kParamOffset = "offset";
+const std::string kParamLength = "length";
+const std::string kParamData = "data";
+const std::string kParamSize = "size";
+
+// in options and when opening a database, Tizen only
+const std::string kParamStatementCacheSize = "statementCacheSize";  // int
+const std::string kParamWalReaderCount = "walReaderCount";          // int
+
 // true when entering, false when leaving, null otherwise
 const std::string kParamInTransaction = "inTransaction";
 
@@ -43,9 +64,39 @@ const std::string kParamColumns = "columns";
 const std::string kParamRows = "rows";
 const std::string kParamDatabases = "databases";
 
+// Query with cursor
+const std::string kParamCursorPageSize = "cursorPageSize";  // int
+const std::string kParamCursorId = "cursorId";              // int
+const std::string kParamCancel = "cancel";                  // boolean
+
 // debugMode
 const std::string kParamCmd = "cmd";  // debugMode cmd: get/set
 const std::string kCmdGet = "get";
+const std::string kCmdProfile = "profile";  // Tizen only
+
+// debugMode get result, Tizen only
+const std::string kParamStatementCache = "statementCache";
+const std::string kParamCacheMaxSize = "maxSize";
+const std::string kParamCacheSize = "size";
+const std::string kParamCacheHits = "hits";
+const std::string kParamCacheMisses = "misses";
+const std::string kParamCacheEvictions = "evictions";
+const std::string kParamCachePrepareTimeUs = "prepareTimeUs";
+
+// debugMode profile arguments and result, Tizen only
+const std::string kParamEnabled = "enabled";  // bool
+const std::string kParamReset = "reset";      // bool
+const std::string kParamStatements = "statements";
+const std::string kParamSlowest = "slowest";
+const std::string kParamCount = "count";
+const std::string kParamPrepareTimeUs = "prepareTimeUs";
+const std::string kParamStepTimeUs = "stepTimeUs";
+const std::string kParamEncodeTimeUs = "encodeTimeUs";
+const std::string kParamP50Us = "p50Us";
+const std::string kParamP95Us = "p95Us";
+const std::string kParamP99Us = "p99Us";
+const std::string kParamMaxUs = "maxUs";
+const std::string kParamTimeUs = "timeUs";
 
 // in batch
 const std::string kParamOperations = "operations";
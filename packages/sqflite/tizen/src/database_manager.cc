@@ -3,6 +3,7 @@
 #include <flutter/standard_method_codec.h>
 #include <sqlite3.h>
 
+#include <chrono>
 #include <list>
 #include <variant>
 
@@ -12,7 +13,37 @@
 
 namespace sqflite_database {
 
+namespace {
+
+// Steps |statement|, adding the time spent to |timings| if not null.
+int StepStmt(sqlite3_stmt *statement, QueryTimings *timings) {
+  if (timings == nullptr) {
+    return sqlite3_step(statement);
+  }
+  auto start = std::chrono::steady_clock::now();
+  int result_code = sqlite3_step(statement);
+  timings->step += std::chrono::steady_clock::now() - start;
+  return result_code;
+}
+
+}  // namespace
+
 DatabaseManager::~DatabaseManager() {
+  // Waits for the queries still running on the readers.
+  readers_.clear();
+  reader_count_ = 0;
+
+  for (auto &&cursor : cursors_) {
+    FinalizeStmt(cursor.second.statement);
+  }
+  cursors_.clear();
+
+  for (auto &&blob : blobs_) {
+    sqlite3_blob_close(blob.second);
+  }
+  blobs_.clear();
+
+  statement_cache_index_.clear();
   for (auto &&statement : statement_cache_) {
     FinalizeStmt(statement.second);
     statement.second = nullptr;
@@ -54,6 +85,38 @@ void DatabaseManager::OpenReadOnly() {
   }
 }
 
+void DatabaseManager::OpenReaders(size_t count) {
+  if (count > kMaxReaderCount) {
+    count = kMaxReaderCount;
+  }
+  if (count == 0) {
+    return;
+  }
+  // The pragma returns the journal mode in effect after the call.
+  auto result = Query("PRAGMA journal_mode=WAL");
+  const std::string *journal_mode = nullptr;
+  if (!result.rows.empty()) {
+    journal_mode = std::get_if<std::string>(
+        &std::get<flutter::EncodableList>(result.rows[0])[0]);
+  }
+  if (journal_mode == nullptr || *journal_mode != "wal") {
+    LOG_WARN("WAL journal mode is not supported for %s", path_.c_str());
+    return;
+  }
+  for (size_t i = 0; i < count; i++) {
+    auto reader = std::make_unique<DatabaseManager>(
+        path_, database_id_, single_instance_, log_level_,
+        statement_cache_max_size_);
+    reader->profiler_ = profiler_;
+    reader->OpenReadOnly();
+    readers_.push_back(std::move(reader));
+    reader_count_ = readers_.size();
+  }
+  if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+    LOG_DEBUG("Opened %zu readers for %s", count, path_.c_str());
+  }
+}
+
 const char *DatabaseManager::GetErrorMsg() { return sqlite3_errmsg(database_); }
 
 int DatabaseManager::GetErrorCode() {
@@ -69,12 +132,18 @@ void DatabaseManager::Close(bool raise_error) {
 }
 
 void DatabaseManager::BindStmtParams(DatabaseManager::Statement statement,
-                                     SQLParameters parameters) {
+                                     const SQLParameters &parameters,
+                                     bool copy_values) {
+  // Unless the statement outlives this call (as for cursors), strings and
+  // blobs are bound without being copied. The bindings are cleared by
+  // ReleaseStmt before |parameters| go out of scope.
+  sqlite3_destructor_type destructor =
+      copy_values ? SQLITE_TRANSIENT : SQLITE_STATIC;
   int result_code = SQLITE_OK;
   const int parameters_length = parameters.size();
   for (int i = 0; i < parameters_length; i++) {
     auto idx = i + 1;
-    auto parameter = parameters[i];
+    const auto &parameter = parameters[i];
     switch (parameter.index()) {
       case 0: {
         result_code = sqlite3_bind_null(statement, idx);
@@ -101,51 +170,58 @@ void DatabaseManager::BindStmtParams(DatabaseManager::Statement statement,
         break;
       }
       case 5: {
-        auto value = std::get<std::string>(parameter);
-        result_code = sqlite3_bind_text(statement, idx, value.c_str(),
-                                        value.size(), SQLITE_TRANSIENT);
+        const auto &value = std::get<std::string>(parameter);
+        result_code =
+            sqlite3_bind_text64(statement, idx, value.data(), value.size(),
+                                destructor, SQLITE_UTF8);
         break;
       }
       case 6: {
-        auto vector = std::get<std::vector<uint8_t>>(parameter);
-        result_code = sqlite3_bind_blob(statement, idx, vector.data(),
-                                        (int)vector.size(), SQLITE_TRANSIENT);
+        const auto &vector = std::get<std::vector<uint8_t>>(parameter);
+        result_code = sqlite3_bind_blob64(statement, idx, vector.data(),
+                                          vector.size(), destructor);
         break;
       }
       case 7: {
-        auto vector = std::get<std::vector<int32_t>>(parameter);
+        const auto &vector = std::get<std::vector<int32_t>>(parameter);
         result_code = sqlite3_bind_blob(statement, idx, vector.data(),
-                                        (int)vector.size(), SQLITE_TRANSIENT);
+                                        (int)vector.size(), destructor);
         break;
       }
       case 8: {
-        auto vector = std::get<std::vector<int64_t>>(parameter);
+        const auto &vector = std::get<std::vector<int64_t>>(parameter);
         result_code = sqlite3_bind_blob(statement, idx, vector.data(),
-                                        (int)vector.size(), SQLITE_TRANSIENT);
+                                        (int)vector.size(), destructor);
         break;
       }
       case 9: {
-        auto vector = std::get<std::vector<double>>(parameter);
+        const auto &vector = std::get<std::vector<double>>(parameter);
         result_code = sqlite3_bind_blob(statement, idx, vector.data(),
-                                        (int)vector.size(), SQLITE_TRANSIENT);
+                                        (int)vector.size(), destructor);
         break;
       }
       case 10: {
-        auto value = std::get<flutter::EncodableList>(parameter);
-        std::vector<uint8_t> vector;
+        const auto &value = std::get<flutter::EncodableList>(parameter);
         // Only  a list of uint8_t for flutter EncodableValue is supported
-        // to store it as a BLOB, otherwise a DatabaseError is triggered
-        try {
-          for (auto item : value) {
-            vector.push_back(std::get<int>(item));
+        // to store it as a BLOB, otherwise a DatabaseError is triggered.
+        // The bytes are converted into a single buffer owned by SQLite.
+        auto *blob =
+            static_cast<uint8_t *>(sqlite3_malloc64(value.size() + 1));
+        if (blob == nullptr) {
+          throw sqflite_errors::DatabaseError(SQLITE_NOMEM, "out of memory");
+        }
+        for (size_t j = 0; j < value.size(); j++) {
+          auto item = std::get_if<int32_t>(&value[j]);
+          if (item == nullptr) {
+            sqlite3_free(blob);
+            throw sqflite_errors::DatabaseError(
+                sqflite_errors::kUnknownErrorCode,
+                "statement parameter is not supported");
           }
-        } catch (const std::bad_variant_access) {
-          throw sqflite_errors::DatabaseError(
-              sqflite_errors::kUnknownErrorCode,
-              "statement parameter is not supported");
+          blob[j] = static_cast<uint8_t>(*item);
         }
-        result_code = sqlite3_bind_blob(statement, idx, vector.data(),
-                                        (int)vector.size(), SQLITE_TRANSIENT);
+        result_code = sqlite3_bind_blob64(statement, idx, blob, value.size(),
+                                          sqlite3_free);
         break;
       }
       default: {
@@ -160,32 +236,107 @@ void DatabaseManager::BindStmtParams(DatabaseManager::Statement statement,
   }
 }
 
-DatabaseManager::Statement DatabaseManager::PrepareStmt(std::string sql) {
-  auto cache_entry = statement_cache_.find(sql);
-  if (cache_entry != statement_cache_.end()) {
-    DatabaseManager::Statement statement = cache_entry->second;
+void DatabaseManager::ReleaseStmt(DatabaseManager::Statement statement) {
+  if (statement == nullptr) {
+    return;
+  }
+  sqlite3_reset(statement);
+  sqlite3_clear_bindings(statement);
+}
+
+DatabaseManager::Statement DatabaseManager::PrepareStmt(
+    const std::string &sql) {
+  // Consecutive runs of the same statement, as in batches, reuse the most
+  // recently used entry without an index lookup.
+  if (!statement_cache_.empty() && statement_cache_.front().first == sql) {
+    statement_cache_hits_++;
+    DatabaseManager::Statement statement = statement_cache_.front().second;
     sqlite3_reset(statement);
     sqlite3_clear_bindings(statement);
     return statement;
-  } else {
-    DatabaseManager::Statement statement;
-    int result_code =
-        sqlite3_prepare_v2(database_, sql.c_str(), -1, &statement, nullptr);
-    if (result_code) {
-      FinalizeStmt(statement);
-      ThrowCurrentDatabaseError();
-    }
-    if (statement != nullptr) {
-      statement_cache_[sql] = statement;
-    }
+  }
+  auto cache_entry = statement_cache_index_.find(sql);
+  if (cache_entry != statement_cache_index_.end()) {
+    statement_cache_hits_++;
+    // Move the entry to the front of the list.
+    statement_cache_.splice(statement_cache_.begin(), statement_cache_,
+                            cache_entry->second);
+    DatabaseManager::Statement statement = cache_entry->second->second;
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
     return statement;
   }
+  statement_cache_misses_++;
+  DatabaseManager::Statement statement = PrepareUncachedStmt(sql);
+  if (statement != nullptr) {
+    TrimStatementCache(statement_cache_max_size_ - 1);
+    statement_cache_.emplace_front(sql, statement);
+    statement_cache_index_.emplace(statement_cache_.front().first,
+                                   statement_cache_.begin());
+    statement_cache_size_ = statement_cache_.size();
+  }
+  return statement;
 }
 
-void DatabaseManager::ExecuteStmt(DatabaseManager::Statement statement) {
+DatabaseManager::Statement DatabaseManager::PrepareUncachedStmt(
+    const std::string &sql) {
+  DatabaseManager::Statement statement;
+  auto start = std::chrono::steady_clock::now();
+  int result_code =
+      sqlite3_prepare_v2(database_, sql.c_str(), -1, &statement, nullptr);
+  prepare_time_us_ += std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  if (result_code) {
+    FinalizeStmt(statement);
+    ThrowCurrentDatabaseError();
+  }
+  return statement;
+}
+
+void DatabaseManager::TrimStatementCache(size_t size) {
+  while (statement_cache_.size() > size) {
+    auto &[sql, statement] = statement_cache_.back();
+    if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+      LOG_DEBUG("Evicting statement from cache: %s", sql.c_str());
+    }
+    FinalizeStmt(statement);
+    statement_cache_index_.erase(sql);
+    statement_cache_.pop_back();
+    statement_cache_evictions_++;
+  }
+  statement_cache_size_ = statement_cache_.size();
+}
+
+void DatabaseManager::SetStatementCacheSize(size_t size) {
+  if (size < 1) {
+    size = 1;
+  }
+  statement_cache_max_size_ = size;
+  TrimStatementCache(size);
+  for (auto &reader : readers_) {
+    DatabaseManager *connection = reader.get();
+    connection->PostTask(
+        [connection, size]() { connection->SetStatementCacheSize(size); });
+  }
+}
+
+StatementCacheStats DatabaseManager::GetStatementCacheStats() {
+  StatementCacheStats stats;
+  stats.max_size = statement_cache_max_size_;
+  stats.size = statement_cache_size_;
+  stats.hits = statement_cache_hits_;
+  stats.misses = statement_cache_misses_;
+  stats.evictions = statement_cache_evictions_;
+  stats.prepare_time_us = prepare_time_us_;
+  return stats;
+}
+
+void DatabaseManager::ExecuteStmt(DatabaseManager::Statement statement,
+                                  QueryTimings *timings) {
   int result_code = SQLITE_OK;
   do {
-    result_code = sqlite3_step(statement);
+    result_code = StepStmt(statement, timings);
   } while (result_code == SQLITE_ROW);
   if (result_code != SQLITE_DONE) {
     ThrowCurrentDatabaseError();
@@ -206,60 +357,90 @@ const char *DatabaseManager::GetColumnName(DatabaseManager::Statement statement,
   return sqlite3_column_name(statement, column_index);
 }
 
-std::pair<Columns, Resultset> DatabaseManager::QueryStmt(
-    DatabaseManager::Statement statement) {
-  Columns columns;
-  Resultset resultset;
+flutter::EncodableValue DatabaseManager::GetColumnValue(
+    DatabaseManager::Statement statement, int column_index) {
+  switch (GetColumnType(statement, column_index)) {
+    case SQLITE_INTEGER:
+      return flutter::EncodableValue(
+          static_cast<int64_t>(sqlite3_column_int64(statement, column_index)));
+    case SQLITE_FLOAT:
+      return flutter::EncodableValue(
+          sqlite3_column_double(statement, column_index));
+    case SQLITE_TEXT: {
+      // sqlite3_column_bytes must be called after sqlite3_column_text so that
+      // it returns the size of the UTF-8 representation.
+      auto text = reinterpret_cast<const char *>(
+          sqlite3_column_text(statement, column_index));
+      auto size = sqlite3_column_bytes(statement, column_index);
+      return flutter::EncodableValue(std::string(text, size));
+    }
+    case SQLITE_BLOB: {
+      auto blob = reinterpret_cast<const uint8_t *>(
+          sqlite3_column_blob(statement, column_index));
+      auto size = sqlite3_column_bytes(statement, column_index);
+      return flutter::EncodableValue(std::vector<uint8_t>(blob, blob + size));
+    }
+    case SQLITE_NULL:
+    default:
+      return flutter::EncodableValue();
+  }
+}
+
+QueryResult DatabaseManager::QueryStmt(DatabaseManager::Statement statement,
+                                       bool rows_as_maps, int max_rows,
+                                       bool *has_more, QueryTimings *timings) {
+  auto start = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration step_time{0};
+  if (timings) {
+    step_time = timings->step;
+  }
+  QueryResult query_result;
   const int columns_count = GetStmtColumnsCount(statement);
   int result_code = SQLITE_OK;
+  // Column names are encoded once per query. Map rows still copy them, since
+  // an EncodableMap owns its keys.
+  query_result.columns.reserve(columns_count);
   for (int i = 0; i < columns_count; i++) {
-    auto column_name = GetColumnName(statement, i);
-    columns.push_back(std::string(column_name));
+    query_result.columns.emplace_back(
+        std::string(GetColumnName(statement, i)));
   }
+  auto &rows = query_result.rows;
   do {
-    result_code = sqlite3_step(statement);
+    result_code = StepStmt(statement, timings);
     if (result_code == SQLITE_ROW) {
-      Result result;
-      for (int i = 0; i < columns_count; i++) {
-        ResultValue value;
-        auto column_type = GetColumnType(statement, i);
-        switch (column_type) {
-          case SQLITE_INTEGER:
-            value = (int64_t)sqlite3_column_int64(statement, i);
-            result.push_back(value);
-            break;
-          case SQLITE_FLOAT:
-            value = sqlite3_column_double(statement, i);
-            result.push_back(value);
-            break;
-          case SQLITE_TEXT:
-            value =
-                std::string((const char *)sqlite3_column_text(statement, i));
-            result.push_back(value);
-            break;
-          case SQLITE_BLOB: {
-            const uint8_t *blob = reinterpret_cast<const uint8_t *>(
-                sqlite3_column_blob(statement, i));
-            std::vector<uint8_t> v(&blob[0],
-                                   &blob[sqlite3_column_bytes(statement, i)]);
-            result.push_back(v);
-            break;
-          }
-          case SQLITE_NULL:
-            value = nullptr;
-            result.push_back(value);
-            break;
-          default:
-            break;
+      if (rows_as_maps) {
+        flutter::EncodableMap row;
+        for (int i = 0; i < columns_count; i++) {
+          row.insert_or_assign(query_result.columns[i],
+                               GetColumnValue(statement, i));
+        }
+        rows.emplace_back(std::move(row));
+      } else {
+        flutter::EncodableList row;
+        row.reserve(columns_count);
+        for (int i = 0; i < columns_count; i++) {
+          row.push_back(GetColumnValue(statement, i));
         }
+        rows.emplace_back(std::move(row));
+      }
+      if (max_rows > 0 && rows.size() >= static_cast<size_t>(max_rows)) {
+        break;
       }
-      resultset.push_back(result);
     }
   } while (result_code == SQLITE_ROW);
-  if (result_code != SQLITE_DONE) {
+  if (result_code != SQLITE_DONE && result_code != SQLITE_ROW) {
     ThrowCurrentDatabaseError();
   }
-  return std::make_pair(columns, resultset);
+  if (has_more) {
+    *has_more = result_code == SQLITE_ROW;
+  }
+  if (timings) {
+    // Everything but stepping is spent encoding the rows.
+    timings->encode += std::chrono::steady_clock::now() - start -
+                       (timings->step - step_time);
+    timings->rows += rows.size();
+  }
+  return query_result;
 }
 
 void DatabaseManager::FinalizeStmt(DatabaseManager::Statement statement) {
@@ -267,25 +448,272 @@ void DatabaseManager::FinalizeStmt(DatabaseManager::Statement statement) {
 }
 
 void DatabaseManager::LogQuery(Statement statement) {
-  LOG_DEBUG("%s", sqlite3_expanded_sql(statement));
+  char *sql = sqlite3_expanded_sql(statement);
+  LOG_DEBUG("%s", sql);
+  sqlite3_free(sql);
 }
 
-std::pair<Columns, Resultset> DatabaseManager::Query(std::string sql,
-                                                     SQLParameters parameters) {
+QueryResult DatabaseManager::Query(const std::string &sql,
+                                   const SQLParameters &parameters,
+                                   bool rows_as_maps) {
+  QueryTimings timings;
+  QueryTimings *profile = profiler_->enabled() ? &timings : nullptr;
+  auto start = std::chrono::steady_clock::now();
   auto statement = PrepareStmt(sql);
-  BindStmtParams(statement, parameters);
-  if (sqflite_log_level::HasSqlLevel(log_level_)) {
-    LogQuery(statement);
+  timings.prepare = std::chrono::steady_clock::now() - start;
+  QueryResult query_result;
+  try {
+    BindStmtParams(statement, parameters);
+    if (sqflite_log_level::HasSqlLevel(log_level_)) {
+      LogQuery(statement);
+    }
+    query_result = QueryStmt(statement, rows_as_maps, 0, nullptr, profile);
+  } catch (...) {
+    ReleaseStmt(statement);
+    throw;
+  }
+  if (profile) {
+    profiler_->Record(sqlite3_sql(statement), timings);
   }
-  return QueryStmt(statement);
+  ReleaseStmt(statement);
+  return query_result;
 }
 
-void DatabaseManager::Execute(std::string sql, SQLParameters parameters) {
+QueryResult DatabaseManager::QueryWithCursor(const std::string &sql,
+                                             const SQLParameters &parameters,
+                                             int page_size, int &cursor_id) {
+  // The statement of a cursor outlives this call, so it must not be shared
+  // with other queries through the statement cache.
+  QueryTimings timings;
+  QueryTimings *profile = profiler_->enabled() ? &timings : nullptr;
+  auto start = std::chrono::steady_clock::now();
+  auto statement = PrepareUncachedStmt(sql);
+  timings.prepare = std::chrono::steady_clock::now() - start;
+  bool has_more = false;
+  QueryResult page;
+  try {
+    BindStmtParams(statement, parameters, true);
+    if (sqflite_log_level::HasSqlLevel(log_level_)) {
+      LogQuery(statement);
+    }
+    page = QueryStmt(statement, false, page_size, &has_more, profile);
+  } catch (...) {
+    FinalizeStmt(statement);
+    throw;
+  }
+  if (profile) {
+    profiler_->Record(sqlite3_sql(statement), timings);
+  }
+  if (!has_more) {
+    FinalizeStmt(statement);
+    cursor_id = 0;
+    return page;
+  }
+  cursor_id = ++last_cursor_id_;
+  cursors_[cursor_id] = Cursor{statement, page_size};
+  if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+    LOG_DEBUG("Cursor %d opened", cursor_id);
+  }
+  return page;
+}
+
+QueryResult DatabaseManager::QueryCursorNext(int cursor_id, bool &has_more) {
+  auto cursor_entry = cursors_.find(cursor_id);
+  if (cursor_entry == cursors_.end()) {
+    throw sqflite_errors::DatabaseError(sqflite_errors::kUnknownErrorCode,
+                                        "Cursor not found");
+  }
+  auto cursor = cursor_entry->second;
+  QueryTimings timings;
+  QueryTimings *profile = profiler_->enabled() ? &timings : nullptr;
+  QueryResult page;
+  try {
+    page = QueryStmt(cursor.statement, false, cursor.page_size, &has_more,
+                     profile);
+  } catch (...) {
+    CloseCursor(cursor_id);
+    throw;
+  }
+  if (profile) {
+    profiler_->Record(sqlite3_sql(cursor.statement), timings);
+  }
+  if (!has_more) {
+    CloseCursor(cursor_id);
+  }
+  return page;
+}
+
+void DatabaseManager::CloseCursor(int cursor_id) {
+  auto cursor_entry = cursors_.find(cursor_id);
+  if (cursor_entry == cursors_.end()) {
+    return;
+  }
+  if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+    LOG_DEBUG("Cursor %d closed", cursor_id);
+  }
+  FinalizeStmt(cursor_entry->second.statement);
+  cursors_.erase(cursor_entry);
+}
+
+int DatabaseManager::OpenBlob(const std::string &table,
+                              const std::string &column, int64_t row_id,
+                              bool writable, int &size) {
+  sqlite3_blob *blob = nullptr;
+  int result_code = sqlite3_blob_open(database_, "main", table.c_str(),
+                                      column.c_str(), row_id, writable, &blob);
+  if (result_code != SQLITE_OK) {
+    // A handle may be returned even on failure.
+    sqlite3_blob_close(blob);
+    ThrowCurrentDatabaseError();
+  }
+  size = sqlite3_blob_bytes(blob);
+  int blob_id = ++last_blob_id_;
+  blobs_[blob_id] = blob;
+  if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+    LOG_DEBUG("Blob %d opened on %s.%s row %lld", blob_id, table.c_str(),
+              column.c_str(), static_cast<long long>(row_id));
+  }
+  return blob_id;
+}
+
+sqlite3_blob *DatabaseManager::GetBlob(int blob_id) {
+  auto blob_entry = blobs_.find(blob_id);
+  if (blob_entry == blobs_.end()) {
+    throw sqflite_errors::DatabaseError(sqflite_errors::kUnknownErrorCode,
+                                        "Blob not found");
+  }
+  return blob_entry->second;
+}
+
+std::vector<uint8_t> DatabaseManager::ReadBlob(int blob_id, int offset,
+                                               int length) {
+  sqlite3_blob *blob = GetBlob(blob_id);
+  const int size = sqlite3_blob_bytes(blob);
+  if (offset < 0 || offset > size || length < 0) {
+    throw sqflite_errors::DatabaseError(SQLITE_RANGE, "Invalid blob range");
+  }
+  std::vector<uint8_t> data(std::min(length, size - offset));
+  int result_code = sqlite3_blob_read(blob, data.data(),
+                                      static_cast<int>(data.size()), offset);
+  if (result_code != SQLITE_OK) {
+    throw sqflite_errors::DatabaseError(result_code,
+                                        sqlite3_errstr(result_code));
+  }
+  return data;
+}
+
+void DatabaseManager::WriteBlob(int blob_id, int offset,
+                                const std::vector<uint8_t> &data) {
+  sqlite3_blob *blob = GetBlob(blob_id);
+  const int size = sqlite3_blob_bytes(blob);
+  if (offset < 0 || offset > size ||
+      data.size() > static_cast<size_t>(size - offset)) {
+    throw sqflite_errors::DatabaseError(SQLITE_RANGE, "Invalid blob range");
+  }
+  int result_code = sqlite3_blob_write(
+      blob, data.data(), static_cast<int>(data.size()), offset);
+  if (result_code != SQLITE_OK) {
+    throw sqflite_errors::DatabaseError(result_code,
+                                        sqlite3_errstr(result_code));
+  }
+}
+
+void DatabaseManager::CloseBlob(int blob_id) {
+  auto blob_entry = blobs_.find(blob_id);
+  if (blob_entry == blobs_.end()) {
+    return;
+  }
+  if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+    LOG_DEBUG("Blob %d closed", blob_id);
+  }
+  int result_code = sqlite3_blob_close(blob_entry->second);
+  blobs_.erase(blob_entry);
+  if (result_code != SQLITE_OK) {
+    ThrowCurrentDatabaseError();
+  }
+}
+
+void DatabaseManager::Execute(const std::string &sql,
+                              const SQLParameters &parameters) {
+  QueryTimings timings;
+  QueryTimings *profile = profiler_->enabled() ? &timings : nullptr;
+  auto start = std::chrono::steady_clock::now();
   Statement statement = PrepareStmt(sql);
-  BindStmtParams(statement, parameters);
-  if (sqflite_log_level::HasSqlLevel(log_level_)) {
-    LogQuery(statement);
+  timings.prepare = std::chrono::steady_clock::now() - start;
+  try {
+    BindStmtParams(statement, parameters);
+    if (sqflite_log_level::HasSqlLevel(log_level_)) {
+      LogQuery(statement);
+    }
+    ExecuteStmt(statement, profile);
+  } catch (...) {
+    ReleaseStmt(statement);
+    throw;
+  }
+  if (profile) {
+    profiler_->Record(sqlite3_sql(statement), timings);
+  }
+  ReleaseStmt(statement);
+}
+
+int64_t DatabaseManager::GetChanges() {
+#if SQLITE_VERSION_NUMBER >= 3037000
+  return sqlite3_changes64(database_);
+#else
+  return sqlite3_changes(database_);
+#endif
+}
+
+int64_t DatabaseManager::GetLastInsertRowId() {
+  return sqlite3_last_insert_rowid(database_);
+}
+
+bool DatabaseManager::IsInTransaction() {
+  return !sqlite3_get_autocommit(database_);
+}
+
+void DatabaseManager::PostTask(std::function<void()> task) {
+  worker_->PostTask(std::move(task));
+}
+
+bool DatabaseManager::IsReadOnlyQuery(const std::string &sql) {
+  auto cached = read_only_queries_.find(sql);
+  if (cached != read_only_queries_.end()) {
+    return cached->second;
+  }
+  // The statement runs on a reader, so it is not kept in the statement cache
+  // of this connection, where it would evict the statements of writes.
+  Statement statement;
+  try {
+    statement = PrepareUncachedStmt(sql);
+  } catch (const sqflite_errors::DatabaseError &) {
+    // Let this connection report the error.
+    return false;
+  }
+  // Transaction control statements are read-only too, but they have no
+  // result columns.
+  bool read_only = sqlite3_stmt_readonly(statement) &&
+                   sqlite3_column_count(statement) > 0;
+  FinalizeStmt(statement);
+  if (read_only_queries_.size() >= statement_cache_max_size_) {
+    read_only_queries_.clear();
   }
-  ExecuteStmt(statement);
+  read_only_queries_.emplace(sql, read_only);
+  return read_only;
+}
+
+void DatabaseManager::PostQueryTask(
+    const std::string &sql, std::function<void(DatabaseManager &)> task) {
+  // The readers are opened on the worker thread, so whether there are any is
+  // only known there.
+  worker_->PostTask([this, sql, task = std::move(task)]() {
+    if (readers_.empty() || IsInTransaction() || !IsReadOnlyQuery(sql)) {
+      task(*this);
+      return;
+    }
+    DatabaseManager *reader = readers_[next_reader_].get();
+    next_reader_ = (next_reader_ + 1) % readers_.size();
+    reader->PostTask([reader, task = std::move(task)]() { task(*reader); });
+  });
 }
 }  // namespace sqflite_database
@@ -4,31 +4,61 @@
 #include <flutter/standard_method_codec.h>
 #include <sqlite3.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <list>
+#include <map>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "database_worker.h"
+#include "query_profiler.h"
 
 namespace sqflite_database {
 
 typedef sqlite3 *Database;
-typedef std::variant<int64_t, std::string, double, std::vector<uint8_t>,
-                     std::nullptr_t>
-    ResultValue;
-typedef std::vector<ResultValue> Result;
-typedef std::vector<Result> Resultset;
-typedef std::vector<std::string> Columns;
 typedef flutter::EncodableList SQLParameters;
 
+// The rows of a query, encoded as they are read from the statement.
+//
+// Each row is an EncodableMap keyed by column name if the query was run with
+// |rows_as_maps|, and an EncodableList of column values otherwise.
+struct QueryResult {
+  flutter::EncodableList columns;
+  flutter::EncodableList rows;
+};
+
+struct StatementCacheStats {
+  size_t max_size;
+  size_t size;
+  int64_t hits;
+  int64_t misses;
+  int64_t evictions;
+  // Total time spent in sqlite3_prepare_v2, in microseconds.
+  int64_t prepare_time_us;
+};
+
 class DatabaseManager {
  public:
   static const int kBusyTimeoutMs = 2500;
+  static const size_t kDefaultStatementCacheSize = 100;
+  static const size_t kMaxReaderCount = 8;
 
   DatabaseManager(std::string path, int database_id, bool single_instance,
-                  int log_level)
+                  int log_level,
+                  size_t statement_cache_size = kDefaultStatementCacheSize)
       : path_(path),
         database_id_(database_id),
         single_instance_(single_instance),
         log_level_(log_level),
-        database_(nullptr){};
+        database_(nullptr),
+        statement_cache_max_size_(std::max<size_t>(statement_cache_size, 1)),
+        profiler_(std::make_shared<QueryProfiler>()),
+        worker_(std::make_unique<DatabaseWorker>()){};
   virtual ~DatabaseManager();
 
   inline const std::string path() { return path_; };
@@ -36,36 +66,133 @@ class DatabaseManager {
   inline const bool single_instance() { return single_instance_; };
   inline const int log_level() { return log_level_; };
   inline const Database database() { return database_; };
+  // Shared with the readers of this database.
+  inline QueryProfiler &profiler() { return *profiler_; };
 
   void Open();
   void OpenReadOnly();
+  // Switches the database to WAL journal mode and opens up to |count|
+  // read-only connections that queries are spread across. Does nothing if
+  // the journal mode cannot be changed, as for in-memory databases.
+  //
+  // Must be run on the worker thread of this database (see PostTask).
+  void OpenReaders(size_t count);
+  // Can be called from any thread.
+  size_t reader_count() { return reader_count_; }
   const char *GetErrorMsg();
   int GetErrorCode();
-  void Execute(std::string sql, SQLParameters parameters = SQLParameters());
-  std::pair<Columns, Resultset> Query(
-      std::string sql, SQLParameters parameters = SQLParameters());
+  void Execute(const std::string &sql,
+               const SQLParameters &parameters = SQLParameters());
+  QueryResult Query(const std::string &sql,
+                    const SQLParameters &parameters = SQLParameters(),
+                    bool rows_as_maps = false);
+  // Returns the number of rows modified by the last INSERT, UPDATE or DELETE.
+  int64_t GetChanges();
+  int64_t GetLastInsertRowId();
+  bool IsInTransaction();
+
+  // Runs a query and returns at most |page_size| rows. If more rows are
+  // available, the statement is kept open and |cursor_id| is set to an id
+  // that can be passed to QueryCursorNext and CloseCursor. Otherwise
+  // |cursor_id| is set to 0.
+  QueryResult QueryWithCursor(const std::string &sql,
+                              const SQLParameters &parameters, int page_size,
+                              int &cursor_id);
+  // Returns the next page of the cursor with |cursor_id|. The cursor is
+  // closed and |has_more| is set to false once all rows have been returned.
+  QueryResult QueryCursorNext(int cursor_id, bool &has_more);
+  void CloseCursor(int cursor_id);
+
+  // Opens a handle for incremental I/O on the BLOB stored in |column| of the
+  // row with |row_id| in |table|, and returns its id. |size| is set to the
+  // size of the BLOB, which cannot be changed through the handle. The handle
+  // expires if the row is modified by other means.
+  int OpenBlob(const std::string &table, const std::string &column,
+               int64_t row_id, bool writable, int &size);
+  // Reads up to |length| bytes starting at |offset|.
+  std::vector<uint8_t> ReadBlob(int blob_id, int offset, int length);
+  void WriteBlob(int blob_id, int offset, const std::vector<uint8_t> &data);
+  void CloseBlob(int blob_id);
+
+  // Sets the maximum number of prepared statements kept in the statement
+  // cache, finalizing the least recently used ones if needed. |size| must be
+  // at least 1.
+  void SetStatementCacheSize(size_t size);
+  // Can be called from any thread.
+  StatementCacheStats GetStatementCacheStats();
+
+  // Runs |task| on the worker thread dedicated to this database. Tasks run
+  // serially in the order they were posted.
+  void PostTask(std::function<void()> task);
+  // Runs |task| with the connection that should execute the read-only query
+  // |sql|: one of the readers if any, or this connection if it is in a
+  // transaction or |sql| may write. The query is dispatched from the worker
+  // thread of this connection, so it sees every write posted before it.
+  void PostQueryTask(const std::string &sql,
+                     std::function<void(DatabaseManager &)> task);
 
  private:
   typedef sqlite3_stmt *Statement;
 
   void Close(bool raise_error);
-  void BindStmtParams(Statement statement, SQLParameters parameters);
-  void ExecuteStmt(Statement statement);
-  std::pair<Columns, Resultset> QueryStmt(Statement statement);
+  void BindStmtParams(Statement statement, const SQLParameters &parameters,
+                      bool copy_values = false);
+  // Resets |statement| and clears its bindings once a call is done with it.
+  void ReleaseStmt(Statement statement);
+  void ExecuteStmt(Statement statement, QueryTimings *timings = nullptr);
+  QueryResult QueryStmt(Statement statement, bool rows_as_maps,
+                        int max_rows = 0, bool *has_more = nullptr,
+                        QueryTimings *timings = nullptr);
   void FinalizeStmt(Statement statement);
-  Statement PrepareStmt(std::string sql);
+  Statement PrepareStmt(const std::string &sql);
+  Statement PrepareUncachedStmt(const std::string &sql);
   int GetStmtColumnsCount(Statement statement);
   int GetColumnType(Statement statement, int column_index);
   const char *GetColumnName(Statement statement, int column_index);
+  flutter::EncodableValue GetColumnValue(Statement statement, int column_index);
   void ThrowCurrentDatabaseError();
   void LogQuery(Statement statement);
+  void TrimStatementCache(size_t size);
+  bool IsReadOnlyQuery(const std::string &sql);
+  sqlite3_blob *GetBlob(int blob_id);
 
-  std::map<std::string, Statement> statement_cache_;
+  struct Cursor {
+    Statement statement;
+    int page_size;
+  };
+
+  typedef std::list<std::pair<std::string, Statement>> StatementList;
+
+  std::map<int, Cursor> cursors_;
+  int last_cursor_id_ = 0;
+  std::map<int, sqlite3_blob *> blobs_;
+  int last_blob_id_ = 0;
   std::string path_;
   int database_id_;
   bool single_instance_;
   int log_level_;
   Database database_;
+
+  // Prepared statements ordered from the most to the least recently used.
+  // The index is keyed by views of the SQL strings owned by the list nodes.
+  StatementList statement_cache_;
+  std::unordered_map<std::string_view, StatementList::iterator>
+      statement_cache_index_;
+  std::atomic<size_t> statement_cache_max_size_;
+  std::atomic<size_t> statement_cache_size_ = 0;
+  std::atomic<int64_t> statement_cache_hits_ = 0;
+  std::atomic<int64_t> statement_cache_misses_ = 0;
+  std::atomic<int64_t> statement_cache_evictions_ = 0;
+  std::atomic<int64_t> prepare_time_us_ = 0;
+  std::shared_ptr<QueryProfiler> profiler_;
+  // Only accessed on the worker thread.
+  std::vector<std::unique_ptr<DatabaseManager>> readers_;
+  std::atomic<size_t> reader_count_ = 0;
+  size_t next_reader_ = 0;
+  // Whether the queries dispatched by PostQueryTask are read-only, keyed by
+  // their SQL. Only accessed on the worker thread.
+  std::unordered_map<std::string, bool> read_only_queries_;
+  std::unique_ptr<DatabaseWorker> worker_;
 };
 }  // namespace sqflite_database
 #endif  // SQFLITE_DATABASE_MANAGER_H_
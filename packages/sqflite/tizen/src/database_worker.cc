@@ -0,0 +1,62 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "database_worker.h"
+
+#include "log.h"
+
+namespace sqflite_database {
+
+DatabaseWorker::DatabaseWorker() : state_(std::make_shared<State>()) {
+  thread_ = std::thread(Run, state_);
+}
+
+DatabaseWorker::~DatabaseWorker() {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->stopped = true;
+  }
+  state_->condition.notify_one();
+
+  // The last reference to the owning database may be released by a task
+  // running on this worker, in which case the thread cannot join itself.
+  // The thread keeps its own reference to the shared state and exits once
+  // the queue is drained.
+  if (thread_.get_id() == std::this_thread::get_id()) {
+    thread_.detach();
+  } else {
+    thread_.join();
+  }
+}
+
+void DatabaseWorker::PostTask(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->tasks.push_back(std::move(task));
+  }
+  state_->condition.notify_one();
+}
+
+void DatabaseWorker::Run(std::shared_ptr<State> state) {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->condition.wait(
+          lock, [&state] { return state->stopped || !state->tasks.empty(); });
+      if (state->tasks.empty()) {
+        return;
+      }
+      task = std::move(state->tasks.front());
+      state->tasks.pop_front();
+    }
+    try {
+      task();
+    } catch (const std::exception &exception) {
+      LOG_ERROR("Uncaught exception in database task: %s", exception.what());
+    }
+  }
+}
+
+}  // namespace sqflite_database
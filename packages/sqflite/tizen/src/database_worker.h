@@ -0,0 +1,49 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SQFLITE_DATABASE_WORKER_H_
+#define SQFLITE_DATABASE_WORKER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sqflite_database {
+
+// A serial task queue backed by a dedicated thread.
+//
+// Tasks posted to the same worker run one at a time in the order they were
+// posted. Tasks that are still pending when the worker is destroyed are run
+// before the thread exits.
+class DatabaseWorker {
+ public:
+  DatabaseWorker();
+  ~DatabaseWorker();
+
+  // Prevent copying.
+  DatabaseWorker(DatabaseWorker const &) = delete;
+  DatabaseWorker &operator=(DatabaseWorker const &) = delete;
+
+  void PostTask(std::function<void()> task);
+
+ private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::function<void()>> tasks;
+    bool stopped = false;
+  };
+
+  static void Run(std::shared_ptr<State> state);
+
+  std::shared_ptr<State> state_;
+  std::thread thread_;
+};
+
+}  // namespace sqflite_database
+
+#endif  // SQFLITE_DATABASE_WORKER_H_
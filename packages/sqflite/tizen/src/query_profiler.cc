@@ -0,0 +1,121 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "query_profiler.h"
+
+#include <algorithm>
+
+namespace sqflite_database {
+
+namespace {
+
+int64_t ToMicroseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+void QueryProfiler::Record(const char *sql, const QueryTimings &timings) {
+  if (sql == nullptr) {
+    return;
+  }
+  const int64_t prepare_time_us = ToMicroseconds(timings.prepare);
+  const int64_t step_time_us = ToMicroseconds(timings.step);
+  const int64_t encode_time_us = ToMicroseconds(timings.encode);
+  const int64_t time_us = prepare_time_us + step_time_us + encode_time_us;
+
+  size_t bucket = 0;
+  while (bucket < kHistogramBuckets - 1 && (int64_t(1) << bucket) <= time_us) {
+    bucket++;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto entry = entries_.find(sql);
+  if (entry == entries_.end()) {
+    // Statements built with inlined values can have unbounded variants, only
+    // the first ones are tracked.
+    if (entries_.size() >= kMaxStatements) {
+      return;
+    }
+    entry = entries_.emplace(sql, Entry()).first;
+  }
+  Entry &stats = entry->second;
+  stats.count++;
+  stats.rows += timings.rows;
+  stats.prepare_time_us += prepare_time_us;
+  stats.step_time_us += step_time_us;
+  stats.encode_time_us += encode_time_us;
+  stats.total_time_us += time_us;
+  stats.max_us = std::max(stats.max_us, time_us);
+  stats.histogram[bucket]++;
+
+  if (slowest_.size() < kSlowestCount || slowest_.back().time_us < time_us) {
+    auto position = std::upper_bound(
+        slowest_.begin(), slowest_.end(), time_us,
+        [](int64_t time, const SlowQuery &query) {
+          return time > query.time_us;
+        });
+    slowest_.insert(position, SlowQuery{sql, time_us, timings.rows});
+    if (slowest_.size() > kSlowestCount) {
+      slowest_.pop_back();
+    }
+  }
+}
+
+void QueryProfiler::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  slowest_.clear();
+}
+
+int64_t QueryProfiler::GetPercentile(const Entry &entry, double percentile) {
+  const double target = entry.count * percentile;
+  int64_t cumulative = 0;
+  for (size_t i = 0; i < kHistogramBuckets; i++) {
+    cumulative += entry.histogram[i];
+    if (cumulative >= target) {
+      return std::min(int64_t(1) << i, entry.max_us);
+    }
+  }
+  return entry.max_us;
+}
+
+std::vector<StatementProfile> QueryProfiler::GetStatementProfiles() {
+  std::vector<std::pair<int64_t, StatementProfile>> profiles;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    profiles.reserve(entries_.size());
+    for (const auto &[sql, entry] : entries_) {
+      StatementProfile profile;
+      profile.sql = sql;
+      profile.count = entry.count;
+      profile.rows = entry.rows;
+      profile.prepare_time_us = entry.prepare_time_us;
+      profile.step_time_us = entry.step_time_us;
+      profile.encode_time_us = entry.encode_time_us;
+      profile.p50_us = GetPercentile(entry, 0.50);
+      profile.p95_us = GetPercentile(entry, 0.95);
+      profile.p99_us = GetPercentile(entry, 0.99);
+      profile.max_us = entry.max_us;
+      profiles.emplace_back(entry.total_time_us, std::move(profile));
+    }
+  }
+  std::sort(profiles.begin(), profiles.end(),
+            [](const auto &a, const auto &b) { return a.first > b.first; });
+
+  std::vector<StatementProfile> result;
+  result.reserve(profiles.size());
+  for (auto &profile : profiles) {
+    result.push_back(std::move(profile.second));
+  }
+  return result;
+}
+
+std::vector<SlowQuery> QueryProfiler::GetSlowestQueries() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slowest_;
+}
+
+}  // namespace sqflite_database
@@ -0,0 +1,97 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SQFLITE_QUERY_PROFILER_H_
+#define SQFLITE_QUERY_PROFILER_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sqflite_database {
+
+// The time spent in each phase of a single statement execution.
+struct QueryTimings {
+  std::chrono::steady_clock::duration prepare{0};
+  std::chrono::steady_clock::duration step{0};
+  std::chrono::steady_clock::duration encode{0};
+  int64_t rows = 0;
+};
+
+struct StatementProfile {
+  std::string sql;
+  int64_t count;
+  int64_t rows;
+  // Total time spent in each phase, in microseconds.
+  int64_t prepare_time_us;
+  int64_t step_time_us;
+  int64_t encode_time_us;
+  // Percentiles of the execution time, in microseconds. They are read from
+  // a histogram with power of two buckets, so they are upper bounds within a
+  // factor of two of the actual values.
+  int64_t p50_us;
+  int64_t p95_us;
+  int64_t p99_us;
+  int64_t max_us;
+};
+
+struct SlowQuery {
+  std::string sql;
+  int64_t time_us;
+  int64_t rows;
+};
+
+// Aggregates the timings of the statements run on a database, keyed by their
+// SQL text as returned by sqlite3_sql, i.e. without the bound parameters.
+//
+// Recording is disabled by default. All methods can be called from any
+// thread.
+class QueryProfiler {
+ public:
+  static const size_t kMaxStatements = 256;
+  static const size_t kSlowestCount = 10;
+
+  bool enabled() const { return enabled_; }
+  void SetEnabled(bool enabled) { enabled_ = enabled; }
+
+  void Record(const char *sql, const QueryTimings &timings);
+  void Reset();
+
+  // Returns the statements ordered from the highest to the lowest total time.
+  std::vector<StatementProfile> GetStatementProfiles();
+  // Returns the slowest single executions, the slowest first.
+  std::vector<SlowQuery> GetSlowestQueries();
+
+ private:
+  static const size_t kHistogramBuckets = 32;
+
+  struct Entry {
+    int64_t count = 0;
+    int64_t rows = 0;
+    int64_t prepare_time_us = 0;
+    int64_t step_time_us = 0;
+    int64_t encode_time_us = 0;
+    int64_t total_time_us = 0;
+    int64_t max_us = 0;
+    // Bucket 0 counts executions under 1 us, bucket i those under 2^i us.
+    std::array<int64_t, kHistogramBuckets> histogram{};
+  };
+
+  static int64_t GetPercentile(const Entry &entry, double percentile);
+
+  std::atomic<bool> enabled_ = false;
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  // Kept sorted from the slowest to the fastest.
+  std::vector<SlowQuery> slowest_;
+};
+
+}  // namespace sqflite_database
+
+#endif  // SQFLITE_QUERY_PROFILER_H_
@@ -4,7 +4,9 @@
 
 #include "sqflite_plugin.h"
 
+#include <Ecore.h>
 #include <app_common.h>
+#include <strings.h>
 #include <flutter/event_channel.h>
 #include <flutter/event_sink.h>
 #include <flutter/event_stream_handler_functions.h>
@@ -12,7 +14,9 @@
 #include <flutter/plugin_registrar.h>
 #include <flutter/standard_method_codec.h>
 
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -25,9 +29,11 @@
 #include "log.h"
 #include "log_level.h"
 
+typedef flutter::MethodResult<flutter::EncodableValue> FlMethodResult;
+
 template <typename T>
-bool GetValueFromEncodableMap(flutter::EncodableMap &map, std::string key,
-                              T &out) {
+bool GetValueFromEncodableMap(const flutter::EncodableMap &map,
+                              const std::string &key, T &out) {
   auto iter = map.find(flutter::EncodableValue(key));
   if (iter != map.end() && !iter->second.IsNull()) {
     if (auto pval = std::get_if<T>(&iter->second)) {
@@ -38,23 +44,29 @@ bool GetValueFromEncodableMap(flutter::EncodableMap &map, std::string key,
   return false;
 }
 
-struct DBResultVisitor {
-  flutter::EncodableValue operator()(int64_t value) {
-    return flutter::EncodableValue(value);
-  };
-  flutter::EncodableValue operator()(std::string value) {
-    return flutter::EncodableValue(value);
-  };
-  flutter::EncodableValue operator()(double value) {
-    return flutter::EncodableValue(value);
-  };
-  flutter::EncodableValue operator()(std::vector<uint8_t> value) {
-    return flutter::EncodableValue(value);
-  };
-  flutter::EncodableValue operator()(std::nullptr_t value) {
-    return flutter::EncodableValue();
-  };
-};
+// Same as GetValueFromEncodableMap, but returns a pointer to the value in
+// |map| instead of copying it. Returns nullptr if the value is missing or is
+// not a T.
+template <typename T>
+const T *GetPointerFromEncodableMap(const flutter::EncodableMap &map,
+                                    const std::string &key) {
+  auto iter = map.find(flutter::EncodableValue(key));
+  if (iter != map.end()) {
+    return std::get_if<T>(&iter->second);
+  }
+  return nullptr;
+}
+
+// Runs |callback| on the platform thread. Can be called from any thread.
+void RunOnPlatformThread(std::function<void()> callback) {
+  ecore_main_loop_thread_safe_call_async(
+      [](void *data) {
+        auto *callback = static_cast<std::function<void()> *>(data);
+        (*callback)();
+        delete callback;
+      },
+      new std::function<void()>(std::move(callback)));
+}
 
 class SqflitePlugin : public flutter::Plugin {
  public:
@@ -98,6 +110,16 @@ class SqflitePlugin : public flutter::Plugin {
       OnExecuteCall(method_call, std::move(result));
     } else if (method_name == sqflite_constants::kMethodQuery) {
       OnQueryCall(method_call, std::move(result));
+    } else if (method_name == sqflite_constants::kMethodQueryCursorNext) {
+      OnQueryCursorNextCall(method_call, std::move(result));
+    } else if (method_name == sqflite_constants::kMethodBlobOpen) {
+      OnBlobOpenCall(method_call, std::move(result));
+    } else if (method_name == sqflite_constants::kMethodBlobRead) {
+      OnBlobReadCall(method_call, std::move(result));
+    } else if (method_name == sqflite_constants::kMethodBlobWrite) {
+      OnBlobWriteCall(method_call, std::move(result));
+    } else if (method_name == sqflite_constants::kMethodBlobClose) {
+      OnBlobCloseCall(method_call, std::move(result));
     } else if (method_name == sqflite_constants::kMethodInsert) {
       OnInsertCall(method_call, std::move(result));
     } else if (method_name == sqflite_constants::kMethodUpdate) {
@@ -135,7 +157,7 @@ class SqflitePlugin : public flutter::Plugin {
     return result;
   }
 
-  bool IsDatabaseOpened(int database_id) {
+  static bool IsDatabaseOpened(int database_id) {
     auto itr = database_map_.find(database_id);
     if (itr != database_map_.end()) {
       return itr->second->database() != nullptr;
@@ -143,10 +165,40 @@ class SqflitePlugin : public flutter::Plugin {
     return false;
   }
 
+  // Returns the database with |database_id|, or reports a closed database
+  // error to |result| and returns nullptr if there is none.
+  static std::shared_ptr<sqflite_database::DatabaseManager> GetOpenedDatabase(
+      int database_id, FlMethodResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto database = GetDatabase(database_id);
+    if (database == nullptr) {
+      result.Error(sqflite_constants::kErrorDatabase,
+                   sqflite_constants::kErrorDatabaseClosed + " " +
+                       std::to_string(database_id));
+    }
+    return database;
+  }
+
+  static void PostSuccess(std::shared_ptr<FlMethodResult> result,
+                          flutter::EncodableValue response) {
+    RunOnPlatformThread([result, response = std::move(response)]() {
+      result->Success(response);
+    });
+  }
+
+  static void PostError(std::shared_ptr<FlMethodResult> result,
+                        std::string error_code, std::string error_message,
+                        flutter::EncodableValue error_details) {
+    RunOnPlatformThread([result, error_code, error_message,
+                         error_details = std::move(error_details)]() {
+      result->Error(error_code, error_message, error_details);
+    });
+  }
+
   static void HandleQueryException(
-      sqflite_errors::DatabaseError exception, std::string sql,
+      const sqflite_errors::DatabaseError &exception, std::string sql,
       sqflite_database::SQLParameters sql_parameters,
-      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+      std::shared_ptr<FlMethodResult> result) {
     flutter::EncodableMap exception_map;
     exception_map.insert(
         std::pair<flutter::EncodableValue, flutter::EncodableValue>(
@@ -156,8 +208,8 @@ class SqflitePlugin : public flutter::Plugin {
         std::pair<flutter::EncodableValue, flutter::EncodableList>(
             flutter::EncodableValue(sqflite_constants::kParamSqlArguments),
             sql_parameters));
-    result->Error(sqflite_constants::kErrorDatabase, exception.what(),
-                  flutter::EncodableValue(exception_map));
+    PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+              flutter::EncodableValue(exception_map));
   }
 
   void OnDebugCall(
@@ -193,6 +245,16 @@ class SqflitePlugin : public flutter::Plugin {
                 flutter::EncodableValue(sqflite_constants::kParamLogLevel),
                 flutter::EncodableValue(database->log_level())));
           }
+          if (database->reader_count() > 0) {
+            info.insert(std::make_pair(
+                flutter::EncodableValue(
+                    sqflite_constants::kParamWalReaderCount),
+                flutter::EncodableValue(
+                    static_cast<int>(database->reader_count()))));
+          }
+          info.insert(std::make_pair(
+              flutter::EncodableValue(sqflite_constants::kParamStatementCache),
+              EncodeStatementCacheStats(database->GetStatementCacheStats())));
           databases_info.insert(
               std::make_pair(flutter::EncodableValue(id), info));
         }
@@ -200,10 +262,105 @@ class SqflitePlugin : public flutter::Plugin {
             flutter::EncodableValue(sqflite_constants::kParamDatabases),
             databases_info));
       }
+    } else if (command == sqflite_constants::kCmdProfile) {
+      bool enabled = profile_queries_;
+      bool reset = false;
+      GetValueFromEncodableMap(arguments, sqflite_constants::kParamEnabled,
+                               enabled);
+      GetValueFromEncodableMap(arguments, sqflite_constants::kParamReset,
+                               reset);
+      profile_queries_ = enabled;
+      map.insert(std::make_pair(
+          flutter::EncodableValue(sqflite_constants::kParamEnabled),
+          flutter::EncodableValue(enabled)));
+      flutter::EncodableMap databases_info;
+      for (const auto &[id, database] : database_map_) {
+        auto &profiler = database->profiler();
+        profiler.SetEnabled(enabled);
+        // The profile collected so far is returned before being reset.
+        databases_info.insert(std::make_pair(flutter::EncodableValue(id),
+                                             EncodeQueryProfile(profiler)));
+        if (reset) {
+          profiler.Reset();
+        }
+      }
+      map.insert(std::make_pair(
+          flutter::EncodableValue(sqflite_constants::kParamDatabases),
+          databases_info));
     }
     result->Success(flutter::EncodableValue(map));
   }
 
+  static flutter::EncodableValue EncodeQueryProfile(
+      sqflite_database::QueryProfiler &profiler) {
+    flutter::EncodableList statements;
+    for (const auto &profile : profiler.GetStatementProfiles()) {
+      statements.push_back(flutter::EncodableValue(flutter::EncodableMap{
+          {flutter::EncodableValue(sqflite_constants::kParamSql),
+           flutter::EncodableValue(profile.sql)},
+          {flutter::EncodableValue(sqflite_constants::kParamCount),
+           flutter::EncodableValue(profile.count)},
+          {flutter::EncodableValue(sqflite_constants::kParamRows),
+           flutter::EncodableValue(profile.rows)},
+          {flutter::EncodableValue(sqflite_constants::kParamPrepareTimeUs),
+           flutter::EncodableValue(profile.prepare_time_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamStepTimeUs),
+           flutter::EncodableValue(profile.step_time_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamEncodeTimeUs),
+           flutter::EncodableValue(profile.encode_time_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamP50Us),
+           flutter::EncodableValue(profile.p50_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamP95Us),
+           flutter::EncodableValue(profile.p95_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamP99Us),
+           flutter::EncodableValue(profile.p99_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamMaxUs),
+           flutter::EncodableValue(profile.max_us)},
+      }));
+    }
+    flutter::EncodableList slowest;
+    for (const auto &query : profiler.GetSlowestQueries()) {
+      slowest.push_back(flutter::EncodableValue(flutter::EncodableMap{
+          {flutter::EncodableValue(sqflite_constants::kParamSql),
+           flutter::EncodableValue(query.sql)},
+          {flutter::EncodableValue(sqflite_constants::kParamTimeUs),
+           flutter::EncodableValue(query.time_us)},
+          {flutter::EncodableValue(sqflite_constants::kParamRows),
+           flutter::EncodableValue(query.rows)},
+      }));
+    }
+    return flutter::EncodableValue(flutter::EncodableMap{
+        {flutter::EncodableValue(sqflite_constants::kParamStatements),
+         flutter::EncodableValue(std::move(statements))},
+        {flutter::EncodableValue(sqflite_constants::kParamSlowest),
+         flutter::EncodableValue(std::move(slowest))},
+    });
+  }
+
+  static flutter::EncodableValue EncodeStatementCacheStats(
+      const sqflite_database::StatementCacheStats &stats) {
+    flutter::EncodableMap map;
+    map.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamCacheMaxSize),
+        flutter::EncodableValue(static_cast<int64_t>(stats.max_size))));
+    map.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamCacheSize),
+        flutter::EncodableValue(static_cast<int64_t>(stats.size))));
+    map.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamCacheHits),
+        flutter::EncodableValue(stats.hits)));
+    map.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamCacheMisses),
+        flutter::EncodableValue(stats.misses)));
+    map.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamCacheEvictions),
+        flutter::EncodableValue(stats.evictions)));
+    map.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamCachePrepareTimeUs),
+        flutter::EncodableValue(stats.prepare_time_us)));
+    return flutter::EncodableValue(map);
+  }
+
   void OnExecuteCall(
       const flutter::MethodCall<flutter::EncodableValue> &method_call,
       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
@@ -219,139 +376,97 @@ class SqflitePlugin : public flutter::Plugin {
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
                              database_id);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto database = GetDatabase(database_id);
+    auto database = GetOpenedDatabase(database_id, *result);
     if (database == nullptr) {
-      result->Error(sqflite_constants::kErrorDatabase,
-                    sqflite_constants::kErrorDatabaseClosed + " " +
-                        std::to_string(database_id));
       return;
     }
-    try {
-      Execute(database, sql, parameters);
-    } catch (const sqflite_errors::DatabaseError &exception) {
-      result->Error(sqflite_constants::kErrorDatabase, exception.what());
-      return;
-    }
-    result->Success();
+    database->PostTask([database, sql, parameters,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      try {
+        Execute(database, sql, parameters);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+                  flutter::EncodableValue());
+        return;
+      }
+      PostSuccess(result, flutter::EncodableValue());
+    });
   }
 
-  void Execute(std::shared_ptr<sqflite_database::DatabaseManager> database,
-               std::string sql, sqflite_database::SQLParameters parameters) {
+  static void Execute(
+      std::shared_ptr<sqflite_database::DatabaseManager> database,
+      const std::string &sql,
+      const sqflite_database::SQLParameters &parameters) {
     database->Execute(sql, parameters);
   }
 
-  int64_t QueryUpdateChanges(
-      std::shared_ptr<sqflite_database::DatabaseManager> database) {
-    std::string changes_sql = "SELECT changes();";
-    auto [_, resultset] = database->Query(changes_sql);
-
-    auto first_result = resultset[0];
-    return std::get<int64_t>(first_result[0]);
-  }
-
-  std::pair<int64_t, int64_t> QueryInsertChanges(
-      std::shared_ptr<sqflite_database::DatabaseManager> database) {
-    std::string changes_sql = "SELECT changes(), last_insert_rowid();";
-
-    auto [_, resultset] = database->Query(changes_sql);
-    auto first_result = resultset[0];
-    auto changes = std::get<int64_t>(first_result[0]);
-    int last_id = 0;
-    if (changes > 0) {
-      last_id = std::get<int64_t>(first_result[1]);
-    }
-    return std::make_pair(changes, last_id);
-  }
-
-  flutter::EncodableValue Update(
+  static flutter::EncodableValue Update(
       std::shared_ptr<sqflite_database::DatabaseManager> database,
-      std::string sql, sqflite_database::SQLParameters parameters,
+      const std::string &sql, const sqflite_database::SQLParameters &parameters,
       bool no_result) {
     database->Execute(sql, parameters);
     if (no_result) {
       return flutter::EncodableValue();
     }
 
-    auto changes = QueryUpdateChanges(database);
+    auto changes = database->GetChanges();
     if (changes > 0 && sqflite_log_level::HasSqlLevel(database->log_level())) {
-      LOG_DEBUG("Number of rows changed: %d", changes);
+      LOG_DEBUG("Number of rows changed: %lld",
+                static_cast<long long>(changes));
     }
     return flutter::EncodableValue(changes);
   }
 
-  flutter::EncodableValue Insert(
+  static flutter::EncodableValue Insert(
       std::shared_ptr<sqflite_database::DatabaseManager> database,
-      std::string sql, sqflite_database::SQLParameters parameters,
+      const std::string &sql, const sqflite_database::SQLParameters &parameters,
       bool no_result) {
     database->Execute(sql, parameters);
     if (no_result) {
       return flutter::EncodableValue();
     }
 
-    auto [changes, last_id] = QueryInsertChanges(database);
-
-    if (changes == 0) {
+    if (database->GetChanges() == 0) {
       if (sqflite_log_level::HasSqlLevel(database->log_level())) {
-        LOG_DEBUG("No changes (id was %d)", last_id);
+        LOG_DEBUG("No changes (id was %lld)",
+                  static_cast<long long>(database->GetLastInsertRowId()));
       }
       return flutter::EncodableValue();
     }
+    auto last_id = database->GetLastInsertRowId();
     if (sqflite_log_level::HasSqlLevel(database->log_level())) {
-      LOG_DEBUG("Inserted id: %d", last_id);
+      LOG_DEBUG("Inserted id: %lld", static_cast<long long>(last_id));
     }
     return flutter::EncodableValue(last_id);
   }
 
-  flutter::EncodableValue Query(
+  static flutter::EncodableValue Query(
       std::shared_ptr<sqflite_database::DatabaseManager> database,
-      std::string sql, sqflite_database::SQLParameters parameters) {
-    auto db_result_visitor = DBResultVisitor{};
-    auto [columns, resultset] = database->Query(sql, parameters);
-    if (query_as_map_list_) {
-      flutter::EncodableList response;
-      if (resultset.size() == 0) {
-        return flutter::EncodableValue(response);
-      }
-      for (const auto &row : resultset) {
-        flutter::EncodableMap row_map;
-        for (size_t i = 0; i < row.size(); i++) {
-          auto row_value = std::visit(db_result_visitor, row[i]);
-          row_map.insert(
-              std::pair<flutter::EncodableValue, flutter::EncodableValue>(
-                  flutter::EncodableValue(columns[i]), row_value));
-        }
-        response.push_back(flutter::EncodableValue(row_map));
-      }
-      return flutter::EncodableValue(response);
-    } else {
-      flutter::EncodableMap response;
-      if (resultset.size() == 0) {
-        return flutter::EncodableValue(response);
-      }
-      flutter::EncodableList columns_response;
-      flutter::EncodableList rows_response;
-      for (const auto &column : columns) {
-        columns_response.push_back(flutter::EncodableValue(column));
-      }
-      for (const auto &row : resultset) {
-        flutter::EncodableList row_list;
-        for (const auto &column : row) {
-          auto row_value = std::visit(db_result_visitor, column);
-          row_list.push_back(row_value);
-        }
-        rows_response.push_back(flutter::EncodableValue(row_list));
-      }
-      response.insert(
-          std::pair<flutter::EncodableValue, flutter::EncodableValue>(
-              flutter::EncodableValue(sqflite_constants::kParamColumns),
-              flutter::EncodableValue(columns_response)));
-      response.insert(
-          std::pair<flutter::EncodableValue, flutter::EncodableValue>(
-              flutter::EncodableValue(sqflite_constants::kParamRows),
-              flutter::EncodableValue(rows_response)));
+      const std::string &sql, const sqflite_database::SQLParameters &parameters,
+      bool query_as_map_list) {
+    return EncodeQueryResult(
+        database->Query(sql, parameters, query_as_map_list), query_as_map_list);
+  }
+
+  // Wraps the already encoded rows of |query_result| into the response format
+  // expected by sqflite. The rows are moved, not copied.
+  static flutter::EncodableValue EncodeQueryResult(
+      sqflite_database::QueryResult query_result, bool query_as_map_list) {
+    if (query_as_map_list) {
+      return flutter::EncodableValue(std::move(query_result.rows));
+    }
+    flutter::EncodableMap response;
+    if (query_result.rows.empty()) {
       return flutter::EncodableValue(response);
     }
+    response.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamColumns),
+        flutter::EncodableValue(std::move(query_result.columns))));
+    response.insert(std::make_pair(
+        flutter::EncodableValue(sqflite_constants::kParamRows),
+        flutter::EncodableValue(std::move(query_result.rows))));
+    return flutter::EncodableValue(std::move(response));
   }
 
   void OnInsertCall(
@@ -372,22 +487,22 @@ class SqflitePlugin : public flutter::Plugin {
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamNoResult,
                              no_result);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto database = GetDatabase(database_id);
+    auto database = GetOpenedDatabase(database_id, *result);
     if (database == nullptr) {
-      result->Error(sqflite_constants::kErrorDatabase,
-                    sqflite_constants::kErrorDatabaseClosed + " " +
-                        std::to_string(database_id));
-      return;
-    }
-    flutter::EncodableValue response;
-    try {
-      response = Insert(database, sql, parameters, no_result);
-    } catch (const sqflite_errors::DatabaseError &exception) {
-      HandleQueryException(exception, sql, parameters, std::move(result));
       return;
     }
-    result->Success(response);
+    database->PostTask([database, sql, parameters, no_result,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      flutter::EncodableValue response;
+      try {
+        response = Insert(database, sql, parameters, no_result);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        HandleQueryException(exception, sql, parameters, result);
+        return;
+      }
+      PostSuccess(result, std::move(response));
+    });
   }
 
   void OnUpdateCall(
@@ -408,22 +523,22 @@ class SqflitePlugin : public flutter::Plugin {
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamNoResult,
                              no_result);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto database = GetDatabase(database_id);
+    auto database = GetOpenedDatabase(database_id, *result);
     if (database == nullptr) {
-      result->Error(sqflite_constants::kErrorDatabase,
-                    sqflite_constants::kErrorDatabaseClosed + " " +
-                        std::to_string(database_id));
       return;
     }
-    flutter::EncodableValue response;
-    try {
-      response = Update(database, sql, parameters, no_result);
-    } catch (const sqflite_errors::DatabaseError &exception) {
-      HandleQueryException(exception, sql, parameters, std::move(result));
-      return;
-    }
-    result->Success(response);
+    database->PostTask([database, sql, parameters, no_result,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      flutter::EncodableValue response;
+      try {
+        response = Update(database, sql, parameters, no_result);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        HandleQueryException(exception, sql, parameters, result);
+        return;
+      }
+      PostSuccess(result, std::move(response));
+    });
   }
 
   void OnOptionsCall(
@@ -433,18 +548,52 @@ class SqflitePlugin : public flutter::Plugin {
         std::get<flutter::EncodableMap>(*method_call.arguments());
     bool parameters_as_list = false;
     int log_level = log_level_;
+    int statement_cache_size = 0;
+    int wal_reader_count = -1;
 
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamQueryAsMapList,
                              parameters_as_list);
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamLogLevel,
                              log_level);
+    GetValueFromEncodableMap(arguments,
+                             sqflite_constants::kParamStatementCacheSize,
+                             statement_cache_size);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamWalReaderCount,
+                             wal_reader_count);
 
     query_as_map_list_ = parameters_as_list;
+    if (wal_reader_count >= 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      wal_reader_count_ = wal_reader_count;
+    }
     log_level_ = log_level;
+    if (statement_cache_size > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      statement_cache_size_ = statement_cache_size;
+      for (const auto &[id, database] : database_map_) {
+        database->PostTask([database = database, statement_cache_size]() {
+          database->SetStatementCacheSize(statement_cache_size);
+        });
+      }
+    }
     // TODO: Implement Thread Priority usage
     result->Success();
   }
 
+  // Returns a page of rows in the columns/rows format, along with the id of
+  // the cursor to fetch the next page from if there are more rows.
+  static flutter::EncodableValue EncodeCursorPage(
+      sqflite_database::QueryResult page, int cursor_id) {
+    flutter::EncodableValue response =
+        EncodeQueryResult(std::move(page), false);
+    if (cursor_id > 0) {
+      std::get<flutter::EncodableMap>(response).insert(std::make_pair(
+          flutter::EncodableValue(sqflite_constants::kParamCursorId),
+          flutter::EncodableValue(cursor_id)));
+    }
+    return response;
+  }
+
   void OnQueryCall(
       const flutter::MethodCall<flutter::EncodableValue> &method_call,
       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
@@ -453,28 +602,254 @@ class SqflitePlugin : public flutter::Plugin {
     int database_id;
     std::string sql;
     sqflite_database::SQLParameters parameters;
+    int cursor_page_size = 0;
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamSqlArguments,
                              parameters);
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamSql, sql);
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
                              database_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamCursorPageSize,
+                             cursor_page_size);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto database = GetDatabase(database_id);
+    auto database = GetOpenedDatabase(database_id, *result);
     if (database == nullptr) {
-      result->Error(sqflite_constants::kErrorDatabase,
-                    sqflite_constants::kErrorDatabaseClosed + " " +
-                        std::to_string(database_id));
       return;
     }
-    flutter::EncodableValue response;
-    try {
-      response = Query(database, sql, parameters);
-    } catch (const sqflite_errors::DatabaseError &exception) {
-      HandleQueryException(exception, sql, parameters, std::move(result));
+    auto shared_result = std::shared_ptr<FlMethodResult>(std::move(result));
+    if (cursor_page_size > 0) {
+      // Cursors keep their statement open across calls, so they always run
+      // on the connection they were opened with.
+      database->PostTask([database, sql, parameters, cursor_page_size,
+                          result = shared_result]() {
+            flutter::EncodableValue response;
+            try {
+              int cursor_id = 0;
+              auto page = database->QueryWithCursor(
+                  sql, parameters, cursor_page_size, cursor_id);
+              response = EncodeCursorPage(std::move(page), cursor_id);
+            } catch (const sqflite_errors::DatabaseError &exception) {
+              HandleQueryException(exception, sql, parameters, result);
+              return;
+            }
+            PostSuccess(result, std::move(response));
+          });
       return;
     }
-    result->Success(response);
+    // The task holds a reference to |database| so that the readers stay open
+    // until it is done.
+    database->PostQueryTask(
+        sql, [database, sql, parameters, query_as_map_list = query_as_map_list_,
+              result = shared_result](
+                 sqflite_database::DatabaseManager &connection) {
+          flutter::EncodableValue response;
+          try {
+            response = EncodeQueryResult(
+                connection.Query(sql, parameters, query_as_map_list),
+                query_as_map_list);
+          } catch (const sqflite_errors::DatabaseError &exception) {
+            HandleQueryException(exception, sql, parameters, result);
+            return;
+          }
+          PostSuccess(result, std::move(response));
+        });
+  }
+
+  void OnQueryCursorNextCall(
+      const flutter::MethodCall<flutter::EncodableValue> &method_call,
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    flutter::EncodableMap arguments =
+        std::get<flutter::EncodableMap>(*method_call.arguments());
+    int database_id;
+    int cursor_id = 0;
+    bool cancel = false;
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
+                             database_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamCursorId,
+                             cursor_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamCancel,
+                             cancel);
+
+    auto database = GetOpenedDatabase(database_id, *result);
+    if (database == nullptr) {
+      return;
+    }
+    database->PostTask([database, cursor_id, cancel,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      if (cancel) {
+        database->CloseCursor(cursor_id);
+        PostSuccess(result, flutter::EncodableValue());
+        return;
+      }
+      flutter::EncodableValue response;
+      try {
+        bool has_more = false;
+        auto page = database->QueryCursorNext(cursor_id, has_more);
+        response = EncodeCursorPage(std::move(page), has_more ? cursor_id : 0);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+                  flutter::EncodableValue());
+        return;
+      }
+      PostSuccess(result, std::move(response));
+    });
+  }
+
+  void OnBlobOpenCall(
+      const flutter::MethodCall<flutter::EncodableValue> &method_call,
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    flutter::EncodableMap arguments =
+        std::get<flutter::EncodableMap>(*method_call.arguments());
+    int database_id;
+    std::string table;
+    std::string column;
+    bool writable = false;
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
+                             database_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamTable, table);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamColumn,
+                             column);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamWritable,
+                             writable);
+    // Row ids are sent as 32-bit integers when they fit.
+    int64_t row_id = 0;
+    auto row_id_entry =
+        arguments.find(flutter::EncodableValue(sqflite_constants::kParamRowId));
+    if (row_id_entry != arguments.end() && !row_id_entry->second.IsNull()) {
+      row_id = row_id_entry->second.LongValue();
+    }
+
+    auto database = GetOpenedDatabase(database_id, *result);
+    if (database == nullptr) {
+      return;
+    }
+    database->PostTask([database, table, column, row_id, writable,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      flutter::EncodableMap response;
+      try {
+        int size = 0;
+        int blob_id =
+            database->OpenBlob(table, column, row_id, writable, size);
+        response.insert(std::make_pair(
+            flutter::EncodableValue(sqflite_constants::kParamBlobId),
+            flutter::EncodableValue(blob_id)));
+        response.insert(std::make_pair(
+            flutter::EncodableValue(sqflite_constants::kParamSize),
+            flutter::EncodableValue(size)));
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+                  flutter::EncodableValue());
+        return;
+      }
+      PostSuccess(result, flutter::EncodableValue(std::move(response)));
+    });
+  }
+
+  void OnBlobReadCall(
+      const flutter::MethodCall<flutter::EncodableValue> &method_call,
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    flutter::EncodableMap arguments =
+        std::get<flutter::EncodableMap>(*method_call.arguments());
+    int database_id;
+    int blob_id = 0;
+    int offset = 0;
+    int length = 0;
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
+                             database_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamBlobId,
+                             blob_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamOffset,
+                             offset);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamLength,
+                             length);
+
+    auto database = GetOpenedDatabase(database_id, *result);
+    if (database == nullptr) {
+      return;
+    }
+    database->PostTask([database, blob_id, offset, length,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      std::vector<uint8_t> data;
+      try {
+        data = database->ReadBlob(blob_id, offset, length);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+                  flutter::EncodableValue());
+        return;
+      }
+      PostSuccess(result, flutter::EncodableValue(std::move(data)));
+    });
+  }
+
+  void OnBlobWriteCall(
+      const flutter::MethodCall<flutter::EncodableValue> &method_call,
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    flutter::EncodableMap arguments =
+        std::get<flutter::EncodableMap>(*method_call.arguments());
+    int database_id;
+    int blob_id = 0;
+    int offset = 0;
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
+                             database_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamBlobId,
+                             blob_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamOffset,
+                             offset);
+    auto *data = GetPointerFromEncodableMap<std::vector<uint8_t>>(
+        arguments, sqflite_constants::kParamData);
+    if (data == nullptr) {
+      result->Error(sqflite_constants::kErrorBadParam, "Missing blob data");
+      return;
+    }
+
+    auto database = GetOpenedDatabase(database_id, *result);
+    if (database == nullptr) {
+      return;
+    }
+    database->PostTask([database, blob_id, offset, data = *data,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      try {
+        database->WriteBlob(blob_id, offset, data);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+                  flutter::EncodableValue());
+        return;
+      }
+      PostSuccess(result, flutter::EncodableValue());
+    });
+  }
+
+  void OnBlobCloseCall(
+      const flutter::MethodCall<flutter::EncodableValue> &method_call,
+      std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>> result) {
+    flutter::EncodableMap arguments =
+        std::get<flutter::EncodableMap>(*method_call.arguments());
+    int database_id;
+    int blob_id = 0;
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
+                             database_id);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamBlobId,
+                             blob_id);
+
+    auto database = GetOpenedDatabase(database_id, *result);
+    if (database == nullptr) {
+      return;
+    }
+    database->PostTask([database, blob_id,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      try {
+        database->CloseBlob(blob_id);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        PostError(result, sqflite_constants::kErrorDatabase, exception.what(),
+                  flutter::EncodableValue());
+        return;
+      }
+      PostSuccess(result, flutter::EncodableValue());
+    });
   }
 
   void OnGetDatabasesPathCall(
@@ -499,20 +874,47 @@ class SqflitePlugin : public flutter::Plugin {
     std::string path;
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamPath, path);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto existing_database_id = GetDatabaseId(path);
-    if (existing_database_id) {
-      if (IsDatabaseOpened(*existing_database_id)) {
-        database_map_.erase(*existing_database_id);
-        single_instances_by_path_.erase(path);
-        if (sqflite_log_level::HasVerboseLevel(log_level_)) {
-          LOG_DEBUG("Deleting database in path %s", path.c_str());
+    std::shared_ptr<sqflite_database::DatabaseManager> database;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto existing_database_id = GetDatabaseId(path);
+      if (existing_database_id) {
+        if (IsDatabaseOpened(*existing_database_id)) {
+          database = GetDatabase(*existing_database_id);
+          database_map_.erase(*existing_database_id);
+          single_instances_by_path_.erase(path);
+          if (sqflite_log_level::HasVerboseLevel(log_level_)) {
+            LOG_DEBUG("Deleting database in path %s", path.c_str());
+          }
         }
       }
     }
-    // TODO: Safe check before delete.
-    std::filesystem::remove(path);
-    result->Success();
+    if (database == nullptr) {
+      // TODO: Safe check before delete.
+      DeleteDatabaseFiles(path);
+      result->Success();
+      return;
+    }
+    // Let the pending operations of the open database complete and close it
+    // before the file is removed.
+    database->PostTask([database, path,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() mutable {
+      database.reset();
+      DeleteDatabaseFiles(path);
+      PostSuccess(result, flutter::EncodableValue());
+    });
+  }
+
+  // Removes the database file at |path| along with its rollback journal and
+  // WAL files, so that a database created later at the same path does not
+  // recover stale pages from them.
+  static void DeleteDatabaseFiles(const std::string &path) {
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    for (const char *suffix : {"-journal", "-wal", "-shm"}) {
+      std::filesystem::remove(path + suffix, error);
+    }
   }
 
   void OnDatabaseExistsCall(
@@ -556,12 +958,15 @@ class SqflitePlugin : public flutter::Plugin {
     std::string path;
     bool read_only = false;
     bool single_instance = false;
+    int wal_reader_count = -1;
 
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamPath, path);
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamReadOnly,
                              read_only);
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamSingleInstance,
                              single_instance);
+    GetValueFromEncodableMap(arguments, sqflite_constants::kParamWalReaderCount,
+                             wal_reader_count);
 
     const bool in_memory = IsInMemoryPath(path);
     single_instance = single_instance && !in_memory;
@@ -597,9 +1002,26 @@ class SqflitePlugin : public flutter::Plugin {
     try {
       std::shared_ptr<sqflite_database::DatabaseManager> database_manager =
           std::make_shared<sqflite_database::DatabaseManager>(
-              path, new_database_id, single_instance, log_level_);
+              path, new_database_id, single_instance, log_level_,
+              statement_cache_size_);
+      database_manager->profiler().SetEnabled(profile_queries_);
       if (!read_only) {
         database_manager->Open();
+        if (wal_reader_count < 0) {
+          wal_reader_count = wal_reader_count_;
+        }
+        if (wal_reader_count > 0 && !in_memory) {
+          // Changing the journal mode and opening the readers do file I/O, so
+          // they run on the worker, before any query posted after the open.
+          database_manager->PostTask([database_manager, wal_reader_count]() {
+            try {
+              database_manager->OpenReaders(wal_reader_count);
+            } catch (const sqflite_errors::DatabaseError &exception) {
+              LOG_WARN("Failed to open the readers of %s: %s",
+                       database_manager->path().c_str(), exception.what());
+            }
+          });
+        }
       } else {
         database_manager->OpenReadOnly();
       }
@@ -632,49 +1054,46 @@ class SqflitePlugin : public flutter::Plugin {
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
                              database_id);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto database = GetDatabase(database_id);
+    auto database = GetOpenedDatabase(database_id, *result);
     if (database == nullptr) {
-      result->Error(sqflite_constants::kErrorDatabase,
-                    sqflite_constants::kErrorDatabaseClosed + " " +
-                        std::to_string(database_id));
       return;
     }
 
     auto path = database->path();
 
-    try {
-      // By erasing the entry from databaseMap, the destructor of
-      // database::DatabaseManager is called, which finalizes all open
-      // statements and closes the database.
-      if (sqflite_log_level::HasSqlLevel(database->log_level())) {
-        LOG_DEBUG("Closing database %d %s", database->database_id(),
-                  database->path().c_str());
-      }
+    if (sqflite_log_level::HasSqlLevel(database->log_level())) {
+      LOG_DEBUG("Closing database %d %s", database->database_id(),
+                database->path().c_str());
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
       database_map_.erase(database_id);
-
       if (database->single_instance()) {
         single_instances_by_path_.erase(path);
       }
-    } catch (const sqflite_errors::DatabaseError &exception) {
-      LOG_ERROR("Error while closing database %d: %s", database_id,
-                exception.what());
-      result->Error(sqflite_constants::kErrorDatabase, exception.what());
-      return;
     }
 
-    result->Success();
+    // By releasing the last reference to database::DatabaseManager after its
+    // pending operations complete, the destructor of the manager is called,
+    // which finalizes all open statements and closes the database.
+    database->PostTask([database,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() mutable {
+      database.reset();
+      PostSuccess(result, flutter::EncodableValue());
+    });
   };
 
-  flutter::EncodableValue BuildSuccessBatchOperationResult(
+  static flutter::EncodableValue BuildSuccessBatchOperationResult(
       flutter::EncodableValue result) {
     flutter::EncodableMap operation_result;
     operation_result.insert(std::make_pair(
-        flutter::EncodableValue(sqflite_constants::kParamResult), result));
+        flutter::EncodableValue(sqflite_constants::kParamResult),
+        std::move(result)));
     return flutter::EncodableValue(operation_result);
   }
 
-  flutter::EncodableValue BuildErrorBatchOperationResult(
+  static flutter::EncodableValue BuildErrorBatchOperationResult(
       const sqflite_errors::DatabaseError &exception, std::string sql,
       sqflite_database::SQLParameters parameters) {
     flutter::EncodableMap operation_result;
@@ -710,7 +1129,6 @@ class SqflitePlugin : public flutter::Plugin {
     bool continue_on_error = false;
     bool no_result = false;
     flutter::EncodableList operations;
-    flutter::EncodableList results;
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamId,
                              database_id);
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamOperations,
@@ -720,112 +1138,170 @@ class SqflitePlugin : public flutter::Plugin {
     GetValueFromEncodableMap(arguments, sqflite_constants::kParamNoResult,
                              no_result);
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto database = GetDatabase(database_id);
+    auto database = GetOpenedDatabase(database_id, *result);
     if (database == nullptr) {
-      result->Error(sqflite_constants::kErrorDatabase,
-                    sqflite_constants::kErrorDatabaseClosed + " " +
-                        std::to_string(database_id));
       return;
     }
+    database->PostTask([database, operations = std::move(operations),
+                        continue_on_error, no_result,
+                        query_as_map_list = query_as_map_list_,
+                        result = std::shared_ptr<FlMethodResult>(
+                            std::move(result))]() {
+      ExecuteBatch(database, operations, continue_on_error, no_result,
+                   query_as_map_list, result);
+    });
+  }
+
+  // Returns true if any operation of a batch controls transactions itself, in
+  // which case the batch must not be wrapped in a transaction.
+  static bool HasTransactionStatement(
+      const flutter::EncodableList &operations) {
+    static const char *kTransactionKeywords[] = {
+        "BEGIN", "COMMIT", "END", "ROLLBACK", "SAVEPOINT", "RELEASE"};
+    for (const auto &item : operations) {
+      const auto &item_map = std::get<flutter::EncodableMap>(item);
+      auto sql =
+          GetPointerFromEncodableMap<std::string>(item_map,
+                                                  sqflite_constants::kParamSql);
+      if (sql == nullptr) {
+        continue;
+      }
+      size_t start = sql->find_first_not_of(" \t\r\n");
+      if (start == std::string::npos) {
+        continue;
+      }
+      for (const char *keyword : kTransactionKeywords) {
+        size_t length = strlen(keyword);
+        if (sql->size() - start >= length &&
+            strncasecmp(sql->c_str() + start, keyword, length) == 0) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
 
+  static void ExecuteBatch(
+      std::shared_ptr<sqflite_database::DatabaseManager> database,
+      const flutter::EncodableList &operations, bool continue_on_error,
+      bool no_result, bool query_as_map_list,
+      std::shared_ptr<FlMethodResult> result) {
+    static const sqflite_database::SQLParameters kNoParameters;
+
+    // Running all operations in a single transaction avoids committing (and
+    // syncing the journal) once per operation. This is skipped if the batch
+    // already runs in a transaction or manages transactions by itself.
+    bool in_batch_transaction = false;
+    if (!database->IsInTransaction() && !HasTransactionStatement(operations)) {
+      try {
+        database->Execute("BEGIN IMMEDIATE");
+        in_batch_transaction = true;
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        LOG_WARN("Running batch without transaction: %s", exception.what());
+      }
+    }
+
+    flutter::EncodableList results;
+    if (!no_result) {
+      results.reserve(operations.size());
+    }
     for (const auto &item : operations) {
-      auto item_map = std::get<flutter::EncodableMap>(item);
+      const auto &item_map = std::get<flutter::EncodableMap>(item);
       std::string method;
       std::string sql;
-      sqflite_database::SQLParameters parameters;
       GetValueFromEncodableMap(item_map, sqflite_constants::kParamMethod,
                                method);
-      GetValueFromEncodableMap(item_map, sqflite_constants::kParamSqlArguments,
-                               parameters);
       GetValueFromEncodableMap(item_map, sqflite_constants::kParamSql, sql);
-
-      if (method == sqflite_constants::kMethodExecute) {
-        try {
+      auto parameters_pointer =
+          GetPointerFromEncodableMap<sqflite_database::SQLParameters>(
+              item_map, sqflite_constants::kParamSqlArguments);
+      const auto &parameters =
+          parameters_pointer ? *parameters_pointer : kNoParameters;
+
+      flutter::EncodableValue response;
+      try {
+        if (method == sqflite_constants::kMethodExecute) {
           Execute(database, sql, parameters);
-          if (!no_result) {
-            auto operation_result =
-                BuildSuccessBatchOperationResult(flutter::EncodableValue());
-            results.push_back(operation_result);
-          }
-        } catch (const sqflite_errors::DatabaseError &exception) {
-          if (!continue_on_error) {
-            HandleQueryException(exception, sql, parameters, std::move(result));
-            return;
-          } else {
-            if (!no_result) {
-              auto operation_result =
-                  BuildErrorBatchOperationResult(exception, sql, parameters);
-              results.push_back(operation_result);
-            }
-          }
-        }
-      } else if (method == sqflite_constants::kMethodInsert) {
-        try {
-          auto response = Insert(database, sql, parameters, no_result);
-          if (!no_result) {
-            auto operation_result = BuildSuccessBatchOperationResult(response);
-            results.push_back(operation_result);
-          }
-        } catch (const sqflite_errors::DatabaseError &exception) {
-          if (!continue_on_error) {
-            HandleQueryException(exception, sql, parameters, std::move(result));
-            return;
-          } else {
-            if (!no_result) {
-              auto operation_result =
-                  BuildErrorBatchOperationResult(exception, sql, parameters);
-              results.push_back(operation_result);
-            }
-          }
+        } else if (method == sqflite_constants::kMethodInsert) {
+          response = Insert(database, sql, parameters, no_result);
+        } else if (method == sqflite_constants::kMethodQuery) {
+          response = Query(database, sql, parameters, query_as_map_list);
+        } else if (method == sqflite_constants::kMethodUpdate) {
+          response = Update(database, sql, parameters, no_result);
+        } else {
+          AbortBatchTransaction(database, in_batch_transaction);
+          RunOnPlatformThread([result]() { result->NotImplemented(); });
+          return;
         }
-      } else if (method == sqflite_constants::kMethodQuery) {
-        try {
-          auto response = Query(database, sql, parameters);
-          if (!no_result) {
-            auto operation_result = BuildSuccessBatchOperationResult(response);
-            results.push_back(operation_result);
-          }
-        } catch (const sqflite_errors::DatabaseError &exception) {
-          if (!continue_on_error) {
-            HandleQueryException(exception, sql, parameters, std::move(result));
-            return;
-          } else {
-            if (!no_result) {
-              auto operation_result =
-                  BuildErrorBatchOperationResult(exception, sql, parameters);
-              results.push_back(operation_result);
-            }
-          }
+        if (!no_result) {
+          results.push_back(
+              BuildSuccessBatchOperationResult(std::move(response)));
         }
-      } else if (method == sqflite_constants::kMethodUpdate) {
-        try {
-          auto response = Update(database, sql, parameters, no_result);
+      } catch (const sqflite_errors::DatabaseError &exception) {
+        if (!continue_on_error) {
+          AbortBatchTransaction(database, in_batch_transaction);
+          HandleQueryException(exception, sql, parameters, result);
+          return;
+        } else if (in_batch_transaction && !database->IsInTransaction()) {
+          // SQLite rolled back the batch transaction by itself (e.g. INSERT
+          // OR ROLLBACK, SQLITE_FULL), undoing the operations reported as
+          // successful so far.
+          HandleQueryException(exception, sql, parameters, result);
+          return;
+        } else {
           if (!no_result) {
-            auto operation_result = BuildSuccessBatchOperationResult(response);
+            auto operation_result =
+                BuildErrorBatchOperationResult(exception, sql, parameters);
             results.push_back(operation_result);
           }
-        } catch (const sqflite_errors::DatabaseError &exception) {
-          if (!continue_on_error) {
-            HandleQueryException(exception, sql, parameters, std::move(result));
-            return;
-          } else {
-            if (!no_result) {
-              auto operation_result =
-                  BuildErrorBatchOperationResult(exception, sql, parameters);
-              results.push_back(operation_result);
-            }
-          }
         }
-      } else {
-        result->NotImplemented();
-        return;
       }
     }
+
+    try {
+      EndBatchTransaction(database, in_batch_transaction);
+    } catch (const sqflite_errors::DatabaseError &exception) {
+      HandleQueryException(exception, "COMMIT", kNoParameters, result);
+      return;
+    }
     if (no_result) {
-      result->Success();
+      PostSuccess(result, flutter::EncodableValue());
     } else {
-      result->Success(flutter::EncodableValue(results));
+      PostSuccess(result, flutter::EncodableValue(std::move(results)));
+    }
+  }
+
+  // Commits the transaction started by ExecuteBatch, unless SQLite already
+  // rolled it back because of an error. If the commit fails, the transaction
+  // is rolled back and the error is rethrown.
+  static void EndBatchTransaction(
+      std::shared_ptr<sqflite_database::DatabaseManager> database,
+      bool in_batch_transaction) {
+    if (!in_batch_transaction || !database->IsInTransaction()) {
+      return;
+    }
+    try {
+      database->Execute("COMMIT");
+    } catch (const sqflite_errors::DatabaseError &exception) {
+      try {
+        database->Execute("ROLLBACK");
+      } catch (const sqflite_errors::DatabaseError &rollback_exception) {
+        LOG_ERROR("Failed to roll back batch: %s", rollback_exception.what());
+      }
+      throw;
+    }
+  }
+
+  // Ends the transaction started by ExecuteBatch when the batch stops early.
+  // Operations that succeeded before are kept, as if they had been run one by
+  // one.
+  static void AbortBatchTransaction(
+      std::shared_ptr<sqflite_database::DatabaseManager> database,
+      bool in_batch_transaction) {
+    try {
+      EndBatchTransaction(database, in_batch_transaction);
+    } catch (const sqflite_errors::DatabaseError &exception) {
+      LOG_ERROR("Failed to commit batch: %s", exception.what());
     }
   }
 
@@ -839,6 +1315,11 @@ class SqflitePlugin : public flutter::Plugin {
   inline static bool query_as_map_list_ = false;
   inline static int database_id_ = 0;  // incremental database id
   inline static int log_level_ = sqflite_log_level::kNone;
+  inline static size_t statement_cache_size_ =
+      sqflite_database::DatabaseManager::kDefaultStatementCacheSize;
+  // The number of read-only connections opened along with new databases.
+  inline static int wal_reader_count_ = 0;
+  inline static bool profile_queries_ = false;
 };
 
 void SqflitePluginRegisterWithRegistrar(
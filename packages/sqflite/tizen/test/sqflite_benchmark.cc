@@ -0,0 +1,170 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs the method handlers of the plugin against the system SQLite and
+// prints the time per operation.
+//
+// Usage: sqflite_benchmark [scale]
+//
+// |scale| (1 by default) multiplies the number of rows and runs.
+
+#include <flutter/standard_method_codec.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include "sqflite_test_client.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using flutter::EncodableList;
+using flutter::EncodableMap;
+using flutter::EncodableValue;
+
+// Runs |operation| |runs| times and prints the mean time per run.
+void Measure(const std::string& name, int runs,
+             const std::function<void()>& operation) {
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < runs; i++) {
+    operation();
+  }
+  double elapsed_us =
+      std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+  printf("%-48s %7d runs %12.1f us/run\n", name.c_str(), runs,
+         elapsed_us / runs);
+}
+
+EncodableValue MakeInsert(const std::string& sql, EncodableList arguments) {
+  return EncodableValue(EncodableMap{
+      {EncodableValue("method"), EncodableValue("insert")},
+      {EncodableValue("sql"), EncodableValue(sql)},
+      {EncodableValue("arguments"), EncodableValue(std::move(arguments))},
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int scale = argc > 1 ? atoi(argv[1]) : 1;
+  if (scale <= 0) {
+    fprintf(stderr, "Usage: %s [scale]\n", argv[0]);
+    return 1;
+  }
+  SqfliteTestClient client;
+  client.SetQueryAsMapList(false);
+  const std::string path = client.GetDatabasePath(
+      "sqflite_benchmark_" + std::to_string(getpid()) + ".db");
+  client.DeleteDatabase(path);
+
+  printf("Open:\n");
+  Measure("open and close", 100 * scale, [&] {
+    client.CloseDatabase(client.OpenDatabase(path));
+  });
+  client.DeleteDatabase(path);
+
+  int id = client.OpenDatabase(path);
+  client.Execute(id,
+                 "CREATE TABLE narrow (id INTEGER PRIMARY KEY, value INTEGER)");
+  std::string wide_columns = "id INTEGER PRIMARY KEY";
+  std::string wide_insert = "INSERT INTO wide VALUES (NULL";
+  for (int i = 0; i < 20; i++) {
+    wide_columns += ", column" + std::to_string(i) + " TEXT";
+    wide_insert += ", ?";
+  }
+  wide_insert += ")";
+  client.Execute(id, "CREATE TABLE wide (" + wide_columns + ")");
+
+  printf("\nInsert:\n");
+  const int row_count = 10000 * scale;
+  Measure("single insert", 100 * scale, [&] {
+    client.Insert(id, "INSERT INTO narrow (value) VALUES (?)",
+                  {EncodableValue(42)});
+  });
+  client.Execute(id, "DELETE FROM narrow");
+  Measure("batch insert of " + std::to_string(row_count) + " narrow rows", 1,
+          [&] {
+            EncodableList operations;
+            for (int i = 0; i < row_count; i++) {
+              operations.push_back(
+                  MakeInsert("INSERT INTO narrow (value) VALUES (?)",
+                             {EncodableValue(i)}));
+            }
+            client.Batch(id, std::move(operations), true);
+          });
+  Measure("batch insert of " + std::to_string(row_count) + " wide rows", 1,
+          [&] {
+            EncodableList operations;
+            for (int i = 0; i < row_count; i++) {
+              EncodableList arguments;
+              for (int j = 0; j < 20; j++) {
+                arguments.push_back(
+                    EncodableValue("value " + std::to_string(i * 20 + j)));
+              }
+              operations.push_back(
+                  MakeInsert(wide_insert, std::move(arguments)));
+            }
+            client.Batch(id, std::move(operations), true);
+          });
+
+  printf("\nQuery (%d rows, handler and standard codec encoding):\n",
+         row_count);
+  const auto& codec = flutter::StandardMethodCodec::GetInstance();
+  for (bool map_list : {false, true}) {
+    client.SetQueryAsMapList(map_list);
+    const char* format = map_list ? "map list" : "columns/rows";
+    for (const char* table : {"narrow", "wide"}) {
+      size_t encoded_size = 0;
+      Measure(std::string(table) + ", " + format, 10, [&] {
+        EncodableValue response =
+            client.Query(id, std::string("SELECT * FROM ") + table);
+        encoded_size = codec.EncodeValue(response).size();
+      });
+      printf("  %zu bytes encoded\n", encoded_size);
+    }
+  }
+  client.SetQueryAsMapList(false);
+
+  printf("\nBlob round trip (write and read through blob handles):\n");
+  client.Execute(id, "CREATE TABLE blobs (id INTEGER PRIMARY KEY, data BLOB)");
+  for (int size : {1024, 64 * 1024, 1024 * 1024, 8 * 1024 * 1024}) {
+    std::vector<uint8_t> data(size, 0x5a);
+    Measure(std::to_string(size / 1024) + " KiB", 10, [&] {
+      EncodableValue row_id =
+          client.Insert(id, "INSERT INTO blobs (data) VALUES (zeroblob(?))",
+                        {EncodableValue(size)});
+      MethodCallResult result = client.Call(
+          "blobOpen", {{EncodableValue("id"), EncodableValue(id)},
+                       {EncodableValue("table"), EncodableValue("blobs")},
+                       {EncodableValue("column"), EncodableValue("data")},
+                       {EncodableValue("rowId"), row_id},
+                       {EncodableValue("writable"), EncodableValue(true)}});
+      EncodableValue blob_id = Lookup(result.value, "blobId");
+      client.Call("blobWrite",
+                  {{EncodableValue("id"), EncodableValue(id)},
+                   {EncodableValue("blobId"), blob_id},
+                   {EncodableValue("offset"), EncodableValue(0)},
+                   {EncodableValue("data"), EncodableValue(data)}});
+      result = client.Call("blobRead",
+                           {{EncodableValue("id"), EncodableValue(id)},
+                            {EncodableValue("blobId"), blob_id},
+                            {EncodableValue("offset"), EncodableValue(0)},
+                            {EncodableValue("length"), EncodableValue(size)}});
+      if (std::get<std::vector<uint8_t>>(result.value) != data) {
+        fprintf(stderr, "Blob mismatch.\n");
+        abort();
+      }
+      client.Call("blobClose", {{EncodableValue("id"), EncodableValue(id)},
+                                {EncodableValue("blobId"), blob_id}});
+    });
+  }
+
+  client.CloseDatabase(id);
+  client.DeleteDatabase(path);
+  return 0;
+}
@@ -0,0 +1,294 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "sqflite_test_client.h"
+
+namespace {
+
+using flutter::EncodableList;
+using flutter::EncodableMap;
+using flutter::EncodableValue;
+
+class SqflitePluginTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    client_.SetQueryAsMapList(false);
+    path_ = client_.GetDatabasePath(
+        std::string("sqflite_test_") + std::to_string(getpid()) + "_" +
+        ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+        ".db");
+    client_.DeleteDatabase(path_);
+  }
+
+  void TearDown() override { client_.DeleteDatabase(path_); }
+
+  // Returns the debug information of the database with |database_id|.
+  EncodableValue GetDebugInfo(int database_id) {
+    MethodCallResult result = client_.Call(
+        "debug", {{EncodableValue("cmd"), EncodableValue("get")}});
+    EXPECT_TRUE(result.success);
+    const auto& databases =
+        std::get<EncodableMap>(Lookup(result.value, "databases"));
+    return databases.at(EncodableValue(database_id));
+  }
+
+  SqfliteTestClient client_;
+  std::string path_;
+};
+
+TEST_F(SqflitePluginTest, InsertAndQuery) {
+  int id = client_.OpenDatabase(path_);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT)");
+  EXPECT_EQ(client_.Insert(id, "INSERT INTO test (name) VALUES (?)",
+                           {EncodableValue("a")}),
+            EncodableValue(int64_t(1)));
+  EXPECT_EQ(client_.Insert(id, "INSERT INTO test (name) VALUES (?)",
+                           {EncodableValue("b")}),
+            EncodableValue(int64_t(2)));
+
+  EncodableValue response = client_.Query(id, "SELECT * FROM test");
+  EXPECT_EQ(Lookup(response, "columns"),
+            EncodableValue(EncodableList{EncodableValue("id"),
+                                         EncodableValue("name")}));
+  EXPECT_EQ(Lookup(response, "rows"),
+            EncodableValue(EncodableList{
+                EncodableValue(EncodableList{EncodableValue(int64_t(1)),
+                                             EncodableValue("a")}),
+                EncodableValue(EncodableList{EncodableValue(int64_t(2)),
+                                             EncodableValue("b")}),
+            }));
+
+  client_.SetQueryAsMapList(true);
+  response = client_.Query(id, "SELECT * FROM test WHERE id = ?",
+                           {EncodableValue(2)});
+  EXPECT_EQ(response, EncodableValue(EncodableList{EncodableValue(EncodableMap{
+                          {EncodableValue("id"), EncodableValue(int64_t(2))},
+                          {EncodableValue("name"), EncodableValue("b")},
+                      })}));
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, QueryError) {
+  int id = client_.OpenDatabase(path_);
+  MethodCallResult result =
+      client_.Call("query", {{EncodableValue("id"), EncodableValue(id)},
+                             {EncodableValue("sql"),
+                              EncodableValue("SELECT * FROM missing")}});
+  EXPECT_FALSE(result.success);
+  EXPECT_EQ(result.error_code, "sqlite_error");
+  EXPECT_EQ(Lookup(result.value, "sql"),
+            EncodableValue("SELECT * FROM missing"));
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, ClosedDatabase) {
+  int id = client_.OpenDatabase(path_);
+  client_.CloseDatabase(id);
+  MethodCallResult result = client_.Call(
+      "query", {{EncodableValue("id"), EncodableValue(id)},
+                {EncodableValue("sql"), EncodableValue("SELECT 1")}});
+  EXPECT_FALSE(result.success);
+  EXPECT_EQ(result.error_code, "sqlite_error");
+}
+
+TEST_F(SqflitePluginTest, Batch) {
+  int id = client_.OpenDatabase(path_);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT)");
+  EncodableList operations;
+  for (int i = 0; i < 3; i++) {
+    operations.push_back(EncodableValue(EncodableMap{
+        {EncodableValue("method"), EncodableValue("insert")},
+        {EncodableValue("sql"),
+         EncodableValue("INSERT INTO test (name) VALUES (?)")},
+        {EncodableValue("arguments"),
+         EncodableValue(EncodableList{EncodableValue(std::to_string(i))})},
+    }));
+  }
+  EncodableValue results = client_.Batch(id, operations);
+  const auto& list = std::get<EncodableList>(results);
+  ASSERT_EQ(list.size(), 3u);
+  EXPECT_EQ(Lookup(list[2], "result"), EncodableValue(int64_t(3)));
+
+  EncodableValue response = client_.Query(id, "SELECT COUNT(*) FROM test");
+  EXPECT_EQ(Lookup(response, "rows"),
+            EncodableValue(EncodableList{
+                EncodableValue(EncodableList{EncodableValue(int64_t(3))})}));
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, BatchRolledBackBySqliteFails) {
+  int id = client_.OpenDatabase(path_);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY)");
+  EncodableList operations;
+  for (const char *sql :
+       {"INSERT INTO test (id) VALUES (1)",
+        "INSERT OR ROLLBACK INTO test (id) VALUES (1)",
+        "INSERT INTO test (id) VALUES (2)"}) {
+    operations.push_back(EncodableValue(EncodableMap{
+        {EncodableValue("method"), EncodableValue("insert")},
+        {EncodableValue("sql"), EncodableValue(sql)},
+    }));
+  }
+  MethodCallResult result = client_.Call(
+      "batch", {{EncodableValue("id"), EncodableValue(id)},
+                {EncodableValue("operations"), EncodableValue(operations)},
+                {EncodableValue("continueOnError"), EncodableValue(true)}});
+  // The first insert was rolled back with the transaction, so it must not
+  // be reported as a success.
+  EXPECT_FALSE(result.success);
+  EXPECT_EQ(result.error_code, "sqlite_error");
+
+  EncodableValue response = client_.Query(id, "SELECT COUNT(*) FROM test");
+  EXPECT_EQ(Lookup(response, "rows"),
+            EncodableValue(EncodableList{
+                EncodableValue(EncodableList{EncodableValue(int64_t(0))})}));
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, Cursor) {
+  int id = client_.OpenDatabase(path_);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY)");
+  for (int i = 0; i < 5; i++) {
+    client_.Insert(id, "INSERT INTO test DEFAULT VALUES");
+  }
+  MethodCallResult result = client_.Call(
+      "query", {{EncodableValue("id"), EncodableValue(id)},
+                {EncodableValue("sql"), EncodableValue("SELECT * FROM test")},
+                {EncodableValue("cursorPageSize"), EncodableValue(2)}});
+  ASSERT_TRUE(result.success);
+  EXPECT_EQ(std::get<EncodableList>(Lookup(result.value, "rows")).size(), 2u);
+  const EncodableValue cursor_id = Lookup(result.value, "cursorId");
+  ASSERT_FALSE(cursor_id.IsNull());
+
+  size_t row_count = 2;
+  while (true) {
+    result = client_.Call("queryCursorNext",
+                          {{EncodableValue("id"), EncodableValue(id)},
+                           {EncodableValue("cursorId"), cursor_id}});
+    ASSERT_TRUE(result.success);
+    row_count += std::get<EncodableList>(Lookup(result.value, "rows")).size();
+    if (Lookup(result.value, "cursorId").IsNull()) {
+      break;
+    }
+  }
+  EXPECT_EQ(row_count, 5u);
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, BlobRoundTrip) {
+  int id = client_.OpenDatabase(path_);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY, data BLOB)");
+  client_.Insert(id, "INSERT INTO test (data) VALUES (zeroblob(16))");
+
+  MethodCallResult result = client_.Call(
+      "blobOpen", {{EncodableValue("id"), EncodableValue(id)},
+                   {EncodableValue("table"), EncodableValue("test")},
+                   {EncodableValue("column"), EncodableValue("data")},
+                   {EncodableValue("rowId"), EncodableValue(1)},
+                   {EncodableValue("writable"), EncodableValue(true)}});
+  ASSERT_TRUE(result.success);
+  EXPECT_EQ(Lookup(result.value, "size"), EncodableValue(16));
+  EncodableValue blob_id = Lookup(result.value, "blobId");
+
+  std::vector<uint8_t> data = {1, 2, 3, 4};
+  result = client_.Call("blobWrite",
+                        {{EncodableValue("id"), EncodableValue(id)},
+                         {EncodableValue("blobId"), blob_id},
+                         {EncodableValue("offset"), EncodableValue(4)},
+                         {EncodableValue("data"), EncodableValue(data)}});
+  ASSERT_TRUE(result.success);
+  result = client_.Call("blobRead",
+                        {{EncodableValue("id"), EncodableValue(id)},
+                         {EncodableValue("blobId"), blob_id},
+                         {EncodableValue("offset"), EncodableValue(4)},
+                         {EncodableValue("length"), EncodableValue(8)}});
+  ASSERT_TRUE(result.success);
+  EXPECT_EQ(result.value,
+            EncodableValue(std::vector<uint8_t>{1, 2, 3, 4, 0, 0, 0, 0}));
+  result = client_.Call("blobClose",
+                        {{EncodableValue("id"), EncodableValue(id)},
+                         {EncodableValue("blobId"), blob_id}});
+  EXPECT_TRUE(result.success);
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, WalReaders) {
+  int id = client_.OpenDatabase(path_, 2);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT)");
+  client_.Insert(id, "INSERT INTO test (name) VALUES ('a')");
+
+  // A query posted right after the open sees the readers and the writes.
+  EncodableValue response = client_.Query(id, "SELECT name FROM test");
+  EXPECT_EQ(Lookup(response, "rows"),
+            EncodableValue(EncodableList{
+                EncodableValue(EncodableList{EncodableValue("a")})}));
+  EXPECT_EQ(Lookup(GetDebugInfo(id), "walReaderCount"), EncodableValue(2));
+  EXPECT_TRUE(std::filesystem::exists(path_ + "-wal"));
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, ReaderQueriesNotCachedByWriter) {
+  int id = client_.OpenDatabase(path_, 1);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY)");
+  auto get_cache_size = [&]() {
+    return Lookup(Lookup(GetDebugInfo(id), "statementCache"), "size");
+  };
+  EncodableValue cache_size = get_cache_size();
+
+  for (int i = 0; i < 10; i++) {
+    client_.Query(id, "SELECT * FROM test WHERE id = " + std::to_string(i));
+  }
+  // The queries have been prepared in the cache of the reader only.
+  EXPECT_EQ(get_cache_size(), cache_size);
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, DeleteOpenDatabaseRemovesWalFiles) {
+  int id = client_.OpenDatabase(path_, 1);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY)");
+  client_.Query(id, "SELECT * FROM test");
+  ASSERT_TRUE(std::filesystem::exists(path_ + "-wal"));
+
+  client_.DeleteDatabase(path_);
+  EXPECT_FALSE(std::filesystem::exists(path_));
+  EXPECT_FALSE(std::filesystem::exists(path_ + "-wal"));
+  EXPECT_FALSE(std::filesystem::exists(path_ + "-shm"));
+}
+
+TEST_F(SqflitePluginTest, DeleteClosedDatabaseRemovesJournal) {
+  int id = client_.OpenDatabase(path_);
+  client_.Execute(id, "CREATE TABLE test (id INTEGER PRIMARY KEY)");
+  client_.CloseDatabase(id);
+  // Left behind by a crash during a transaction.
+  std::ofstream(path_ + "-journal") << "stale";
+
+  client_.DeleteDatabase(path_);
+  EXPECT_FALSE(std::filesystem::exists(path_));
+  EXPECT_FALSE(std::filesystem::exists(path_ + "-journal"));
+}
+
+TEST_F(SqflitePluginTest, DatabaseExists) {
+  auto exists = [&]() {
+    return client_.Call("databaseExists",
+                        {{EncodableValue("path"), EncodableValue(path_)}})
+        .value;
+  };
+  EXPECT_EQ(exists(), EncodableValue(false));
+  int id = client_.OpenDatabase(path_);
+  EXPECT_EQ(exists(), EncodableValue(true));
+  client_.CloseDatabase(id);
+}
+
+TEST_F(SqflitePluginTest, UnknownMethod) {
+  EXPECT_TRUE(client_.Call("unknown").not_implemented);
+}
+
+}  // namespace
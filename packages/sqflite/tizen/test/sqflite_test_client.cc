@@ -0,0 +1,208 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "sqflite_test_client.h"
+
+#include <Ecore.h>
+#include <flutter/plugin_registrar.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "sqflite_plugin.h"
+
+namespace {
+
+constexpr char kChannelName[] = "com.tekartik.sqflite";
+
+// A method call is considered stuck after this long.
+constexpr int kCallTimeoutMs = 30000;
+
+class RecordingMethodResult
+    : public flutter::MethodResult<flutter::EncodableValue> {
+ public:
+  RecordingMethodResult(MethodCallResult* result, bool* done)
+      : result_(result), done_(done) {}
+
+ protected:
+  void SuccessInternal(const flutter::EncodableValue* result) override {
+    result_->success = true;
+    if (result) {
+      result_->value = *result;
+    }
+    *done_ = true;
+  }
+
+  void ErrorInternal(const std::string& error_code,
+                     const std::string& error_message,
+                     const flutter::EncodableValue* error_details) override {
+    result_->error_code = error_code;
+    result_->error_message = error_message;
+    if (error_details) {
+      result_->value = *error_details;
+    }
+    *done_ = true;
+  }
+
+  void NotImplementedInternal() override {
+    result_->not_implemented = true;
+    *done_ = true;
+  }
+
+ private:
+  MethodCallResult* result_;
+  bool* done_;
+};
+
+FlutterDesktopPluginRegistrarRef GetRegistrarRef() {
+  static int registrar;
+  return reinterpret_cast<FlutterDesktopPluginRegistrarRef>(&registrar);
+}
+
+const flutter::MethodCallHandler<flutter::EncodableValue>& GetHandler() {
+  static const auto* handler = [] {
+    SqflitePluginRegisterWithRegistrar(GetRegistrarRef());
+    return flutter::PluginRegistrarManager::GetInstance()
+        ->GetRegistrar<flutter::PluginRegistrar>(GetRegistrarRef())
+        ->messenger()
+        ->GetMethodCallHandler(kChannelName);
+  }();
+  if (!handler) {
+    fprintf(stderr, "The plugin has not registered its method channel.\n");
+    abort();
+  }
+  return *handler;
+}
+
+void CheckSuccess(const std::string& method, const MethodCallResult& result) {
+  if (!result.success) {
+    fprintf(stderr, "%s failed: %s %s\n", method.c_str(),
+            result.error_code.c_str(), result.error_message.c_str());
+    abort();
+  }
+}
+
+}  // namespace
+
+const flutter::EncodableValue& Lookup(const flutter::EncodableValue& map,
+                                      const std::string& key) {
+  static const flutter::EncodableValue kNull;
+  const auto* entries = std::get_if<flutter::EncodableMap>(&map);
+  if (!entries) {
+    return kNull;
+  }
+  auto iter = entries->find(flutter::EncodableValue(key));
+  return iter == entries->end() ? kNull : iter->second;
+}
+
+SqfliteTestClient::SqfliteTestClient() { GetHandler(); }
+
+MethodCallResult SqfliteTestClient::Call(const std::string& method,
+                                         flutter::EncodableMap arguments) {
+  MethodCallResult result;
+  bool done = false;
+  flutter::MethodCall<flutter::EncodableValue> call(
+      method, std::make_unique<flutter::EncodableValue>(std::move(arguments)));
+  GetHandler()(call, std::make_unique<RecordingMethodResult>(&result, &done));
+  int waited_ms = 0;
+  while (!done) {
+    if (RunMainLoopOnce(100) == 0) {
+      waited_ms += 100;
+      if (waited_ms >= kCallTimeoutMs) {
+        fprintf(stderr, "%s did not return.\n", method.c_str());
+        abort();
+      }
+    }
+  }
+  return result;
+}
+
+int SqfliteTestClient::OpenDatabase(const std::string& path,
+                                    int wal_reader_count) {
+  flutter::EncodableMap arguments = {
+      {flutter::EncodableValue("path"), flutter::EncodableValue(path)},
+  };
+  if (wal_reader_count >= 0) {
+    arguments[flutter::EncodableValue("walReaderCount")] =
+        flutter::EncodableValue(wal_reader_count);
+  }
+  MethodCallResult result = Call("openDatabase", std::move(arguments));
+  CheckSuccess("openDatabase", result);
+  return std::get<int32_t>(Lookup(result.value, "id"));
+}
+
+void SqfliteTestClient::CloseDatabase(int database_id) {
+  CheckSuccess("closeDatabase",
+               Call("closeDatabase", {{flutter::EncodableValue("id"),
+                                       flutter::EncodableValue(database_id)}}));
+}
+
+void SqfliteTestClient::DeleteDatabase(const std::string& path) {
+  CheckSuccess("deleteDatabase",
+               Call("deleteDatabase", {{flutter::EncodableValue("path"),
+                                        flutter::EncodableValue(path)}}));
+}
+
+void SqfliteTestClient::Execute(int database_id, const std::string& sql,
+                                flutter::EncodableList arguments) {
+  CheckSuccess(
+      sql, Call("execute",
+                {{flutter::EncodableValue("id"),
+                  flutter::EncodableValue(database_id)},
+                 {flutter::EncodableValue("sql"), flutter::EncodableValue(sql)},
+                 {flutter::EncodableValue("arguments"),
+                  flutter::EncodableValue(std::move(arguments))}}));
+}
+
+flutter::EncodableValue SqfliteTestClient::Insert(
+    int database_id, const std::string& sql, flutter::EncodableList arguments) {
+  MethodCallResult result =
+      Call("insert", {{flutter::EncodableValue("id"),
+                       flutter::EncodableValue(database_id)},
+                      {flutter::EncodableValue("sql"),
+                       flutter::EncodableValue(sql)},
+                      {flutter::EncodableValue("arguments"),
+                       flutter::EncodableValue(std::move(arguments))}});
+  CheckSuccess(sql, result);
+  return result.value;
+}
+
+flutter::EncodableValue SqfliteTestClient::Query(
+    int database_id, const std::string& sql, flutter::EncodableList arguments) {
+  MethodCallResult result =
+      Call("query", {{flutter::EncodableValue("id"),
+                      flutter::EncodableValue(database_id)},
+                     {flutter::EncodableValue("sql"),
+                      flutter::EncodableValue(sql)},
+                     {flutter::EncodableValue("arguments"),
+                      flutter::EncodableValue(std::move(arguments))}});
+  CheckSuccess(sql, result);
+  return result.value;
+}
+
+flutter::EncodableValue SqfliteTestClient::Batch(
+    int database_id, flutter::EncodableList operations, bool no_result) {
+  MethodCallResult result =
+      Call("batch", {{flutter::EncodableValue("id"),
+                      flutter::EncodableValue(database_id)},
+                     {flutter::EncodableValue("operations"),
+                      flutter::EncodableValue(std::move(operations))},
+                     {flutter::EncodableValue("noResult"),
+                      flutter::EncodableValue(no_result)}});
+  CheckSuccess("batch", result);
+  return result.value;
+}
+
+void SqfliteTestClient::SetQueryAsMapList(bool query_as_map_list) {
+  CheckSuccess("options",
+               Call("options", {{flutter::EncodableValue("queryAsMapList"),
+                                 flutter::EncodableValue(query_as_map_list)}}));
+}
+
+std::string SqfliteTestClient::GetDatabasePath(const std::string& name) {
+  MethodCallResult result = Call("getDatabasesPath");
+  CheckSuccess("getDatabasesPath", result);
+  return std::get<std::string>(result.value) + "/" + name;
+}
@@ -0,0 +1,54 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef SQFLITE_TEST_CLIENT_H_
+#define SQFLITE_TEST_CLIENT_H_
+
+#include <flutter/encodable_value.h>
+
+#include <string>
+
+// The outcome of a method call.
+struct MethodCallResult {
+  bool success = false;
+  bool not_implemented = false;
+  flutter::EncodableValue value;
+  std::string error_code;
+  std::string error_message;
+};
+
+// Calls the methods of the plugin as the Dart side of sqflite would. The
+// plugin is registered once per process.
+class SqfliteTestClient {
+ public:
+  SqfliteTestClient();
+
+  // Calls |method| and runs the main loop until it returns.
+  MethodCallResult Call(const std::string& method,
+                        flutter::EncodableMap arguments = {});
+
+  // Helpers for the common calls. They abort the test on failure.
+  int OpenDatabase(const std::string& path, int wal_reader_count = -1);
+  void CloseDatabase(int database_id);
+  void DeleteDatabase(const std::string& path);
+  void Execute(int database_id, const std::string& sql,
+               flutter::EncodableList arguments = {});
+  flutter::EncodableValue Insert(int database_id, const std::string& sql,
+                                 flutter::EncodableList arguments = {});
+  flutter::EncodableValue Query(int database_id, const std::string& sql,
+                                flutter::EncodableList arguments = {});
+  flutter::EncodableValue Batch(int database_id,
+                                flutter::EncodableList operations,
+                                bool no_result = false);
+  void SetQueryAsMapList(bool query_as_map_list);
+
+  // Returns the path of |name| in the databases directory.
+  std::string GetDatabasePath(const std::string& name);
+};
+
+// Returns the value of |key| in |map|, or null if missing.
+const flutter::EncodableValue& Lookup(const flutter::EncodableValue& map,
+                                      const std::string& key);
+
+#endif  // SQFLITE_TEST_CLIENT_H_
@@ -0,0 +1,19 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host replacement of the Ecore main loop calls used by the plugin. The
+// callbacks are queued until the test runs them with RunMainLoopOnce().
+
+#ifndef FLUTTER_TEST_STUBS_ECORE_H_
+#define FLUTTER_TEST_STUBS_ECORE_H_
+
+typedef void (*Ecore_Cb)(void* data);
+
+void ecore_main_loop_thread_safe_call_async(Ecore_Cb callback, void* data);
+
+// Runs the queued callbacks, waiting up to |timeout_ms| for one if there is
+// none. Returns the number of callbacks run.
+int RunMainLoopOnce(int timeout_ms);
+
+#endif  // FLUTTER_TEST_STUBS_ECORE_H_
@@ -0,0 +1,12 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_APP_COMMON_H_
+#define FLUTTER_TEST_STUBS_APP_COMMON_H_
+
+// Returns a copy of the SQFLITE_TEST_DATA_PATH environment variable, or of
+// the temporary directory if it is not set. The caller must free it.
+char* app_get_data_path(void);
+
+#endif  // FLUTTER_TEST_STUBS_APP_COMMON_H_
@@ -0,0 +1,43 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host replacement of the Tizen dlog API. Logs are written to stderr if the
+// DLOG_STDERR environment variable is set, and dropped otherwise.
+
+#ifndef FLUTTER_TEST_STUBS_DLOG_H_
+#define FLUTTER_TEST_STUBS_DLOG_H_
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum {
+  DLOG_UNKNOWN = 0,
+  DLOG_DEFAULT,
+  DLOG_VERBOSE,
+  DLOG_DEBUG,
+  DLOG_INFO,
+  DLOG_WARN,
+  DLOG_ERROR,
+  DLOG_FATAL,
+  DLOG_SILENT,
+} log_priority;
+
+inline int dlog_print(log_priority prio, const char* tag, const char* fmt,
+                      ...) {
+  static const bool enabled = getenv("DLOG_STDERR") != nullptr;
+  if (!enabled) {
+    return 0;
+  }
+  va_list args;
+  va_start(args, fmt);
+  fprintf(stderr, "[%s] ", tag);
+  int ret = vfprintf(stderr, fmt, args);
+  fputc('\n', stderr);
+  va_end(args);
+  return ret;
+}
+
+#endif  // FLUTTER_TEST_STUBS_DLOG_H_
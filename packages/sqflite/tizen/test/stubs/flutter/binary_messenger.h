@@ -0,0 +1,44 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_BINARY_MESSENGER_H_
+#define FLUTTER_TEST_STUBS_BINARY_MESSENGER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "encodable_value.h"
+#include "method_call.h"
+#include "method_result.h"
+
+namespace flutter {
+
+template <typename T>
+using MethodCallHandler = std::function<void(
+    const MethodCall<T>& call, std::unique_ptr<MethodResult<T>> result)>;
+
+// Unlike the real messenger, which passes encoded messages, this one keeps
+// the method call handlers so that tests can call them directly.
+class BinaryMessenger {
+ public:
+  void SetMethodCallHandler(const std::string& channel,
+                            MethodCallHandler<EncodableValue> handler) {
+    handlers_[channel] = std::move(handler);
+  }
+
+  const MethodCallHandler<EncodableValue>* GetMethodCallHandler(
+      const std::string& channel) const {
+    auto iter = handlers_.find(channel);
+    return iter == handlers_.end() ? nullptr : &iter->second;
+  }
+
+ private:
+  std::map<std::string, MethodCallHandler<EncodableValue>> handlers_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_TEST_STUBS_BINARY_MESSENGER_H_
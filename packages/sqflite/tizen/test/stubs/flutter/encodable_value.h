@@ -0,0 +1,87 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A host replacement of the EncodableValue of the Flutter C++ client wrapper,
+// with the same variant layout.
+
+#ifndef FLUTTER_TEST_STUBS_ENCODABLE_VALUE_H_
+#define FLUTTER_TEST_STUBS_ENCODABLE_VALUE_H_
+
+#include <any>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace flutter {
+
+class EncodableValue;
+
+using EncodableList = std::vector<EncodableValue>;
+using EncodableMap = std::map<EncodableValue, EncodableValue>;
+
+class CustomEncodableValue {
+ public:
+  explicit CustomEncodableValue(const std::any& value) : value_(value) {}
+
+  operator std::any&() { return value_; }
+  operator const std::any&() const { return value_; }
+
+ private:
+  std::any value_;
+};
+
+inline bool operator<(const CustomEncodableValue& a,
+                      const CustomEncodableValue& b) {
+  return &a < &b;
+}
+
+inline bool operator==(const CustomEncodableValue& a,
+                       const CustomEncodableValue& b) {
+  return &a == &b;
+}
+
+using EncodableValueVariant =
+    std::variant<std::monostate, bool, int32_t, int64_t, double, std::string,
+                 std::vector<uint8_t>, std::vector<int32_t>,
+                 std::vector<int64_t>, std::vector<double>, EncodableList,
+                 EncodableMap, CustomEncodableValue, std::vector<float>>;
+
+class EncodableValue : public EncodableValueVariant {
+ public:
+  using super = EncodableValueVariant;
+  using super::super;
+  using super::operator=;
+
+  EncodableValue() = default;
+
+  explicit EncodableValue(const char* string) : super(std::string(string)) {}
+  EncodableValue& operator=(const char* other) {
+    *this = std::string(other);
+    return *this;
+  }
+
+  template <class T>
+  constexpr explicit EncodableValue(T&& t) noexcept
+      : super(std::forward<T>(t)) {}
+
+  bool IsNull() const { return std::holds_alternative<std::monostate>(*this); }
+
+  int64_t LongValue() const {
+    if (std::holds_alternative<int32_t>(*this)) {
+      return std::get<int32_t>(*this);
+    }
+    return std::get<int64_t>(*this);
+  }
+
+  friend bool operator<(const EncodableValue& lhs, const EncodableValue& rhs) {
+    return static_cast<const super&>(lhs) < static_cast<const super&>(rhs);
+  }
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_TEST_STUBS_ENCODABLE_VALUE_H_
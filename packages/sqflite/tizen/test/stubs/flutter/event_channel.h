@@ -0,0 +1,12 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Included by the plugin, but not used.
+
+#ifndef FLUTTER_TEST_STUBS_EVENT_CHANNEL_H_
+#define FLUTTER_TEST_STUBS_EVENT_CHANNEL_H_
+
+#include "encodable_value.h"
+
+#endif  // FLUTTER_TEST_STUBS_EVENT_CHANNEL_H_
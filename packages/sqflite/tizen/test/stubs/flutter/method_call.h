@@ -0,0 +1,29 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_METHOD_CALL_H_
+#define FLUTTER_TEST_STUBS_METHOD_CALL_H_
+
+#include <memory>
+#include <string>
+
+namespace flutter {
+
+template <typename T>
+class MethodCall {
+ public:
+  MethodCall(const std::string& method_name, std::unique_ptr<T> arguments)
+      : method_name_(method_name), arguments_(std::move(arguments)) {}
+
+  const std::string& method_name() const { return method_name_; }
+  const T* arguments() const { return arguments_.get(); }
+
+ private:
+  std::string method_name_;
+  std::unique_ptr<T> arguments_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_TEST_STUBS_METHOD_CALL_H_
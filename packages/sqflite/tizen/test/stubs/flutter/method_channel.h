@@ -0,0 +1,35 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_METHOD_CHANNEL_H_
+#define FLUTTER_TEST_STUBS_METHOD_CHANNEL_H_
+
+#include <string>
+
+#include "binary_messenger.h"
+#include "standard_method_codec.h"
+
+namespace flutter {
+
+template <typename T = EncodableValue>
+class MethodChannel {
+ public:
+  MethodChannel(BinaryMessenger* messenger, const std::string& name,
+                const MethodCodec<T>* codec)
+      : messenger_(messenger), name_(name) {}
+
+  // The handler stays registered after the channel is destroyed, as with the
+  // real messenger.
+  void SetMethodCallHandler(MethodCallHandler<T> handler) const {
+    messenger_->SetMethodCallHandler(name_, std::move(handler));
+  }
+
+ private:
+  BinaryMessenger* messenger_;
+  std::string name_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_TEST_STUBS_METHOD_CHANNEL_H_
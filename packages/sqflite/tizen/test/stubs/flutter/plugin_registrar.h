@@ -0,0 +1,59 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_PLUGIN_REGISTRAR_H_
+#define FLUTTER_TEST_STUBS_PLUGIN_REGISTRAR_H_
+
+#include <flutter_plugin_registrar.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "binary_messenger.h"
+
+namespace flutter {
+
+class Plugin {
+ public:
+  virtual ~Plugin() = default;
+};
+
+class PluginRegistrar {
+ public:
+  BinaryMessenger* messenger() { return &messenger_; }
+
+  void AddPlugin(std::unique_ptr<Plugin> plugin) {
+    plugins_.push_back(std::move(plugin));
+  }
+
+ private:
+  BinaryMessenger messenger_;
+  std::vector<std::unique_ptr<Plugin>> plugins_;
+};
+
+class PluginRegistrarManager {
+ public:
+  static PluginRegistrarManager* GetInstance() {
+    static PluginRegistrarManager instance;
+    return &instance;
+  }
+
+  template <class T>
+  T* GetRegistrar(FlutterDesktopPluginRegistrarRef registrar_ref) {
+    auto& registrar = registrars_[registrar_ref];
+    if (!registrar) {
+      registrar = std::make_unique<T>();
+    }
+    return registrar.get();
+  }
+
+ private:
+  std::map<FlutterDesktopPluginRegistrarRef, std::unique_ptr<PluginRegistrar>>
+      registrars_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_TEST_STUBS_PLUGIN_REGISTRAR_H_
@@ -0,0 +1,37 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_STANDARD_METHOD_CODEC_H_
+#define FLUTTER_TEST_STUBS_STANDARD_METHOD_CODEC_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "encodable_value.h"
+#include "method_call.h"
+#include "method_result.h"
+
+namespace flutter {
+
+template <typename T>
+class MethodCodec {
+ public:
+  virtual ~MethodCodec() = default;
+};
+
+class StandardMethodCodec : public MethodCodec<EncodableValue> {
+ public:
+  static const StandardMethodCodec& GetInstance() {
+    static StandardMethodCodec instance;
+    return instance;
+  }
+
+  // Encodes |value| in the format of the standard message codec, as the
+  // messenger does with every method call result.
+  std::vector<uint8_t> EncodeValue(const EncodableValue& value) const;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_TEST_STUBS_STANDARD_METHOD_CODEC_H_
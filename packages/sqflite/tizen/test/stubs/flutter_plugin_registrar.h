@@ -0,0 +1,10 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_TEST_STUBS_FLUTTER_PLUGIN_REGISTRAR_H_
+#define FLUTTER_TEST_STUBS_FLUTTER_PLUGIN_REGISTRAR_H_
+
+typedef struct FlutterDesktopPluginRegistrar* FlutterDesktopPluginRegistrarRef;
+
+#endif  // FLUTTER_TEST_STUBS_FLUTTER_PLUGIN_REGISTRAR_H_
@@ -0,0 +1,214 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Implementations of the stubbed platform functions.
+
+#include <Ecore.h>
+#include <app_common.h>
+#include <flutter/standard_method_codec.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace {
+
+struct MainLoop {
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<std::pair<Ecore_Cb, void*>> callbacks;
+};
+
+MainLoop& GetMainLoop() {
+  static MainLoop main_loop;
+  return main_loop;
+}
+
+// The type tags and the size encoding of the standard message codec.
+enum class EncodedType : uint8_t {
+  kNull = 0,
+  kTrue,
+  kFalse,
+  kInt32,
+  kInt64,
+  kLargeInt,
+  kFloat64,
+  kString,
+  kUInt8List,
+  kInt32List,
+  kInt64List,
+  kFloat64List,
+  kList,
+  kMap,
+  kFloat32List,
+};
+
+class Encoder {
+ public:
+  explicit Encoder(std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+
+  void Write(const flutter::EncodableValue& value) {
+    switch (value.index()) {
+      case 0:
+        WriteType(EncodedType::kNull);
+        break;
+      case 1:
+        WriteType(std::get<bool>(value) ? EncodedType::kTrue
+                                        : EncodedType::kFalse);
+        break;
+      case 2:
+        WriteType(EncodedType::kInt32);
+        WriteBytes(std::get<int32_t>(value));
+        break;
+      case 3:
+        WriteType(EncodedType::kInt64);
+        WriteBytes(std::get<int64_t>(value));
+        break;
+      case 4:
+        WriteType(EncodedType::kFloat64);
+        Align(8);
+        WriteBytes(std::get<double>(value));
+        break;
+      case 5: {
+        const auto& string = std::get<std::string>(value);
+        WriteType(EncodedType::kString);
+        WriteSize(string.size());
+        buffer_.insert(buffer_.end(), string.begin(), string.end());
+        break;
+      }
+      case 6:
+        WriteTypedList(EncodedType::kUInt8List,
+                       std::get<std::vector<uint8_t>>(value));
+        break;
+      case 7:
+        WriteTypedList(EncodedType::kInt32List,
+                       std::get<std::vector<int32_t>>(value));
+        break;
+      case 8:
+        WriteTypedList(EncodedType::kInt64List,
+                       std::get<std::vector<int64_t>>(value));
+        break;
+      case 9:
+        WriteTypedList(EncodedType::kFloat64List,
+                       std::get<std::vector<double>>(value));
+        break;
+      case 10: {
+        const auto& list = std::get<flutter::EncodableList>(value);
+        WriteType(EncodedType::kList);
+        WriteSize(list.size());
+        for (const auto& item : list) {
+          Write(item);
+        }
+        break;
+      }
+      case 11: {
+        const auto& map = std::get<flutter::EncodableMap>(value);
+        WriteType(EncodedType::kMap);
+        WriteSize(map.size());
+        for (const auto& [key, item] : map) {
+          Write(key);
+          Write(item);
+        }
+        break;
+      }
+      case 13:
+        WriteTypedList(EncodedType::kFloat32List,
+                       std::get<std::vector<float>>(value));
+        break;
+      default:
+        abort();
+    }
+  }
+
+ private:
+  void WriteType(EncodedType type) {
+    buffer_.push_back(static_cast<uint8_t>(type));
+  }
+
+  template <typename T>
+  void WriteBytes(const T& value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+  }
+
+  void WriteSize(size_t size) {
+    if (size < 254) {
+      buffer_.push_back(static_cast<uint8_t>(size));
+    } else if (size <= 0xffff) {
+      buffer_.push_back(254);
+      WriteBytes(static_cast<uint16_t>(size));
+    } else {
+      buffer_.push_back(255);
+      WriteBytes(static_cast<uint32_t>(size));
+    }
+  }
+
+  void Align(size_t alignment) {
+    while (buffer_.size() % alignment != 0) {
+      buffer_.push_back(0);
+    }
+  }
+
+  template <typename T>
+  void WriteTypedList(EncodedType type, const std::vector<T>& list) {
+    WriteType(type);
+    WriteSize(list.size());
+    Align(sizeof(T));
+    const auto* bytes = reinterpret_cast<const uint8_t*>(list.data());
+    buffer_.insert(buffer_.end(), bytes, bytes + list.size() * sizeof(T));
+  }
+
+  std::vector<uint8_t>& buffer_;
+};
+
+}  // namespace
+
+void ecore_main_loop_thread_safe_call_async(Ecore_Cb callback, void* data) {
+  MainLoop& main_loop = GetMainLoop();
+  {
+    std::lock_guard<std::mutex> lock(main_loop.mutex);
+    main_loop.callbacks.emplace_back(callback, data);
+  }
+  main_loop.condition.notify_one();
+}
+
+int RunMainLoopOnce(int timeout_ms) {
+  MainLoop& main_loop = GetMainLoop();
+  std::deque<std::pair<Ecore_Cb, void*>> callbacks;
+  {
+    std::unique_lock<std::mutex> lock(main_loop.mutex);
+    main_loop.condition.wait_for(
+        lock, std::chrono::milliseconds(timeout_ms),
+        [&main_loop] { return !main_loop.callbacks.empty(); });
+    callbacks.swap(main_loop.callbacks);
+  }
+  for (auto& [callback, data] : callbacks) {
+    callback(data);
+  }
+  return static_cast<int>(callbacks.size());
+}
+
+char* app_get_data_path(void) {
+  const char* path = getenv("SQFLITE_TEST_DATA_PATH");
+  if (path == nullptr) {
+    path = getenv("TMPDIR");
+  }
+  return strdup(path ? path : "/tmp");
+}
+
+namespace flutter {
+
+std::vector<uint8_t> StandardMethodCodec::EncodeValue(
+    const EncodableValue& value) const {
+  // A success envelope starts with a zero byte.
+  std::vector<uint8_t> buffer = {0};
+  Encoder(buffer).Write(value);
+  return buffer;
+}
+
+}  // namespace flutter
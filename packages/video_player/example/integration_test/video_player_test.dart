@@ -7,12 +7,15 @@ import 'dart:io';
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter/material.dart';
-import 'package:flutter/services.dart' show rootBundle;
+import 'package:flutter/services.dart' show PlatformException, rootBundle;
 import 'package:flutter_test/flutter_test.dart';
 import 'package:flutter_tizen/flutter_tizen.dart';
 import 'package:integration_test/integration_test.dart';
 import 'package:path_provider/path_provider.dart';
 import 'package:video_player/video_player.dart';
+import 'package:video_player_platform_interface/video_player_platform_interface.dart'
+    show DataSource, DataSourceType;
+import 'package:video_player_tizen/video_player_tizen.dart';
 
 const Duration _playDuration = Duration(seconds: 1);
 
@@ -98,6 +101,106 @@ void main() {
       expect(controller.value.position, const Duration(seconds: 3));
     });
 
+    testWidgets('reports frame stats', (WidgetTester tester) async {
+      await controller.initialize();
+      await controller.setVolume(0);
+
+      await controller.play();
+      await tester.pumpAndSettle(_playDuration);
+      await controller.pause();
+
+      final VideoFrameStats stats =
+          await VideoPlayerTizen().getFrameStats(controller.textureId);
+      expect(stats.decoded, greaterThan(0));
+      expect(stats.presented, greaterThan(0));
+      expect(
+        stats.presented + stats.droppedLate + stats.droppedOverflow,
+        lessThanOrEqualTo(stats.decoded),
+      );
+      expect(stats.ringFull, greaterThanOrEqualTo(0));
+    });
+
+    testWidgets('reports progress at the set interval', (
+      WidgetTester tester,
+    ) async {
+      await controller.initialize();
+      await controller.setVolume(0);
+      await VideoPlayerTizen().setProgressInterval(
+        controller.textureId,
+        const Duration(milliseconds: 100),
+      );
+
+      await controller.play();
+      await tester.pumpAndSettle(_playDuration);
+
+      expect(controller.value.isPlaying, true);
+      expect(controller.value.position, greaterThan(Duration.zero));
+
+      await VideoPlayerTizen().setProgressInterval(
+        controller.textureId,
+        Duration.zero,
+      );
+      await controller.pause();
+    });
+
+    testWidgets('can set texture slot count', (WidgetTester tester) async {
+      final VideoPlayerTizen tizenPlayer = VideoPlayerTizen();
+      await expectLater(
+        tizenPlayer.setTextureSlotCount(1),
+        throwsA(isA<PlatformException>()),
+      );
+      await tizenPlayer.setTextureSlotCount(2);
+      addTearDown(() => tizenPlayer.setTextureSlotCount(3));
+
+      await controller.initialize();
+      await controller.setVolume(0);
+      await controller.play();
+      await tester.pumpAndSettle(_playDuration);
+
+      expect(controller.value.isPlaying, true);
+      expect(controller.value.position, greaterThan(Duration.zero));
+    });
+
+    testWidgets('can extract thumbnails', (WidgetTester tester) async {
+      await controller.initialize();
+
+      final VideoPlayerTizen tizenPlayer = VideoPlayerTizen();
+      final List<VideoThumbnail> thumbnails = await tizenPlayer.getThumbnails(
+        controller.textureId,
+        const <Duration>[Duration.zero, Duration(seconds: 3)],
+        maxWidth: 64,
+      );
+
+      expect(thumbnails, hasLength(2));
+      expect(thumbnails[1].position, const Duration(seconds: 3));
+      for (final VideoThumbnail thumbnail in thumbnails) {
+        expect(thumbnail.width, lessThanOrEqualTo(64));
+        expect(
+          thumbnail.rgba,
+          hasLength(thumbnail.width * thumbnail.height * 4),
+        );
+      }
+      expect(controller.value.position, Duration.zero);
+    });
+
+    testWidgets('can be created from a preloaded player', (
+      WidgetTester tester,
+    ) async {
+      final VideoPlayerTizen tizenPlayer = VideoPlayerTizen();
+      final VideoPreloadStats before = await tizenPlayer.getPreloadStats();
+      await tizenPlayer.preload(
+        DataSource(sourceType: DataSourceType.asset, asset: _videoAssetKey),
+      );
+
+      await controller.initialize();
+
+      final VideoPreloadStats after = await tizenPlayer.getPreloadStats();
+      expect(after.hits, before.hits + 1);
+      expect(after.size, 0);
+      expect(controller.value.isInitialized, true);
+      expect(controller.value.position, Duration.zero);
+    });
+
     testWidgets('can be paused', (WidgetTester tester) async {
       await controller.initialize();
       // Mute to allow playing without DOM interaction on Web.
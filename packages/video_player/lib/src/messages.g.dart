@@ -203,6 +203,238 @@ class MixWithOthersMessage {
   }
 }
 
+class FrameStatsMessage {
+  FrameStatsMessage({
+    required this.textureId,
+    required this.decoded,
+    required this.presented,
+    required this.droppedLate,
+    required this.droppedOverflow,
+    required this.averageRenderLatencyUs,
+    required this.ringFull,
+  });
+
+  int textureId;
+
+  int decoded;
+
+  int presented;
+
+  int droppedLate;
+
+  int droppedOverflow;
+
+  int averageRenderLatencyUs;
+
+  int ringFull;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      decoded,
+      presented,
+      droppedLate,
+      droppedOverflow,
+      averageRenderLatencyUs,
+      ringFull,
+    ];
+  }
+
+  static FrameStatsMessage decode(Object result) {
+    result as List<Object?>;
+    return FrameStatsMessage(
+      textureId: result[0]! as int,
+      decoded: result[1]! as int,
+      presented: result[2]! as int,
+      droppedLate: result[3]! as int,
+      droppedOverflow: result[4]! as int,
+      averageRenderLatencyUs: result[5]! as int,
+      ringFull: result[6]! as int,
+    );
+  }
+}
+
+class TextureSlotCountMessage {
+  TextureSlotCountMessage({
+    required this.slotCount,
+  });
+
+  int slotCount;
+
+  Object encode() {
+    return <Object?>[
+      slotCount,
+    ];
+  }
+
+  static TextureSlotCountMessage decode(Object result) {
+    result as List<Object?>;
+    return TextureSlotCountMessage(
+      slotCount: result[0]! as int,
+    );
+  }
+}
+
+class PreloadPoolSizeMessage {
+  PreloadPoolSizeMessage({
+    required this.maxSize,
+  });
+
+  int maxSize;
+
+  Object encode() {
+    return <Object?>[
+      maxSize,
+    ];
+  }
+
+  static PreloadPoolSizeMessage decode(Object result) {
+    result as List<Object?>;
+    return PreloadPoolSizeMessage(
+      maxSize: result[0]! as int,
+    );
+  }
+}
+
+class PreloadStatsMessage {
+  PreloadStatsMessage({
+    required this.size,
+    required this.maxSize,
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+  });
+
+  int size;
+
+  int maxSize;
+
+  int hits;
+
+  int misses;
+
+  int evictions;
+
+  Object encode() {
+    return <Object?>[
+      size,
+      maxSize,
+      hits,
+      misses,
+      evictions,
+    ];
+  }
+
+  static PreloadStatsMessage decode(Object result) {
+    result as List<Object?>;
+    return PreloadStatsMessage(
+      size: result[0]! as int,
+      maxSize: result[1]! as int,
+      hits: result[2]! as int,
+      misses: result[3]! as int,
+      evictions: result[4]! as int,
+    );
+  }
+}
+
+class ProgressIntervalMessage {
+  ProgressIntervalMessage({
+    required this.textureId,
+    required this.intervalMs,
+  });
+
+  int textureId;
+
+  int intervalMs;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      intervalMs,
+    ];
+  }
+
+  static ProgressIntervalMessage decode(Object result) {
+    result as List<Object?>;
+    return ProgressIntervalMessage(
+      textureId: result[0]! as int,
+      intervalMs: result[1]! as int,
+    );
+  }
+}
+
+class ThumbnailRequestMessage {
+  ThumbnailRequestMessage({
+    required this.textureId,
+    required this.positions,
+    required this.maxWidth,
+    required this.accurate,
+  });
+
+  int textureId;
+
+  List<int> positions;
+
+  int maxWidth;
+
+  bool accurate;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      positions,
+      maxWidth,
+      accurate,
+    ];
+  }
+
+  static ThumbnailRequestMessage decode(Object result) {
+    result as List<Object?>;
+    return ThumbnailRequestMessage(
+      textureId: result[0]! as int,
+      positions: (result[1] as List<Object?>?)!.cast<int>(),
+      maxWidth: result[2]! as int,
+      accurate: result[3]! as bool,
+    );
+  }
+}
+
+class ThumbnailMessage {
+  ThumbnailMessage({
+    required this.position,
+    required this.width,
+    required this.height,
+    required this.rgba,
+  });
+
+  int position;
+
+  int width;
+
+  int height;
+
+  Uint8List rgba;
+
+  Object encode() {
+    return <Object?>[
+      position,
+      width,
+      height,
+      rgba,
+    ];
+  }
+
+  static ThumbnailMessage decode(Object result) {
+    result as List<Object?>;
+    return ThumbnailMessage(
+      position: result[0]! as int,
+      width: result[1]! as int,
+      height: result[2]! as int,
+      rgba: result[3]! as Uint8List,
+    );
+  }
+}
+
 class _PigeonCodec extends StandardMessageCodec {
   const _PigeonCodec();
   @override
@@ -231,6 +463,27 @@ class _PigeonCodec extends StandardMessageCodec {
     } else if (value is MixWithOthersMessage) {
       buffer.putUint8(135);
       writeValue(buffer, value.encode());
+    } else if (value is FrameStatsMessage) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.encode());
+    } else if (value is TextureSlotCountMessage) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.encode());
+    } else if (value is PreloadPoolSizeMessage) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.encode());
+    } else if (value is PreloadStatsMessage) {
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    } else if (value is ProgressIntervalMessage) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    } else if (value is ThumbnailRequestMessage) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    } else if (value is ThumbnailMessage) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -253,6 +506,20 @@ class _PigeonCodec extends StandardMessageCodec {
         return CreateMessage.decode(readValue(buffer)!);
       case 135:
         return MixWithOthersMessage.decode(readValue(buffer)!);
+      case 136:
+        return FrameStatsMessage.decode(readValue(buffer)!);
+      case 137:
+        return TextureSlotCountMessage.decode(readValue(buffer)!);
+      case 138:
+        return PreloadPoolSizeMessage.decode(readValue(buffer)!);
+      case 139:
+        return PreloadStatsMessage.decode(readValue(buffer)!);
+      case 140:
+        return ProgressIntervalMessage.decode(readValue(buffer)!);
+      case 141:
+        return ThumbnailRequestMessage.decode(readValue(buffer)!);
+      case 142:
+        return ThumbnailMessage.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
@@ -547,4 +814,188 @@ class TizenVideoPlayerApi {
       return;
     }
   }
+
+  Future<FrameStatsMessage> frameStats(TextureMessage msg) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.frameStats$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[msg]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as FrameStatsMessage?)!;
+    }
+  }
+
+  Future<void> setTextureSlotCount(TextureSlotCountMessage msg) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.setTextureSlotCount$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[msg]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> preload(CreateMessage msg) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.preload$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[msg]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setPreloadPoolSize(PreloadPoolSizeMessage msg) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.setPreloadPoolSize$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[msg]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<PreloadStatsMessage> preloadStats() async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.preloadStats$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as PreloadStatsMessage?)!;
+    }
+  }
+
+  Future<void> setProgressInterval(ProgressIntervalMessage msg) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.setProgressInterval$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[msg]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<List<ThumbnailMessage>> thumbnails(ThumbnailRequestMessage msg) async {
+    final String pigeonVar_channelName =
+        'dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.thumbnails$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel =
+        BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[msg]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as List<Object?>?)!
+          .cast<ThumbnailMessage>();
+    }
+  }
 }
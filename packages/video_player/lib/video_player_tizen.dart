@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 import 'dart:async';
+import 'dart:typed_data';
 
 import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
@@ -18,6 +19,13 @@ import 'src/messages.g.dart';
 class VideoPlayerTizen extends VideoPlayerPlatform {
   final TizenVideoPlayerApi _api = TizenVideoPlayerApi();
 
+  // The players that send progress events, and their latest reported
+  // positions and playing states. Shared by all instances, since the one
+  // that enables the events may not be the registered instance.
+  static final Set<int> _progressTextureIds = <int>{};
+  static final Map<int, Duration> _progressPositions = <int, Duration>{};
+  static final Map<int, bool> _progressIsPlaying = <int, bool>{};
+
   /// Registers this class as the default platform instance.
   static void register() {
     VideoPlayerPlatform.instance = VideoPlayerTizen();
@@ -30,11 +38,113 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
 
   @override
   Future<void> dispose(int textureId) {
+    _progressTextureIds.remove(textureId);
+    _progressPositions.remove(textureId);
+    _progressIsPlaying.remove(textureId);
     return _api.dispose(TextureMessage(textureId: textureId));
   }
 
   @override
   Future<int?> create(DataSource dataSource) async {
+    final TextureMessage response = await _api.create(
+      _toCreateMessage(dataSource),
+    );
+    return response.textureId;
+  }
+
+  /// Prepares a player for [dataSource] in the background, so that a later
+  /// [create] call with the same source returns without waiting for the
+  /// player to be prepared.
+  ///
+  /// Preloaded players are kept paused at the start of the video, in a pool
+  /// where the least recently preloaded one is disposed when the pool is
+  /// full. Sources are matched by URI only.
+  Future<void> preload(DataSource dataSource) {
+    return _api.preload(_toCreateMessage(dataSource));
+  }
+
+  /// Sets the maximum number of preloaded players. The default is 2.
+  ///
+  /// Setting 0 disposes all preloaded players and disables preloading.
+  Future<void> setPreloadPoolSize(int maxSize) {
+    return _api.setPreloadPoolSize(PreloadPoolSizeMessage(maxSize: maxSize));
+  }
+
+  /// Returns the usage statistics of the preloaded player pool.
+  Future<VideoPreloadStats> getPreloadStats() async {
+    final PreloadStatsMessage response = await _api.preloadStats();
+    return VideoPreloadStats(
+      size: response.size,
+      maxSize: response.maxSize,
+      hits: response.hits,
+      misses: response.misses,
+      evictions: response.evictions,
+    );
+  }
+
+  /// Decodes the frames of the video played by the player with [textureId] at
+  /// [positions], e.g. for seek bar previews.
+  ///
+  /// The frames are decoded on a background thread without seeking the
+  /// player, rotated as the video is displayed, and scaled down to at most
+  /// [maxWidth] pixels wide. A [maxWidth] of 0 keeps the full resolution,
+  /// which takes about 8 MB per frame of a 1080p video. By default the
+  /// nearest key frames are used, which is much faster than decoding the
+  /// exact frames with [accurate]. Positions that cannot be decoded are
+  /// omitted from the result.
+  ///
+  /// Only videos from assets and local files are supported.
+  Future<List<VideoThumbnail>> getThumbnails(
+    int textureId,
+    List<Duration> positions, {
+    int maxWidth = 320,
+    bool accurate = false,
+  }) async {
+    final List<ThumbnailMessage> response = await _api.thumbnails(
+      ThumbnailRequestMessage(
+        textureId: textureId,
+        positions: positions
+            .map((Duration position) => position.inMilliseconds)
+            .toList(),
+        maxWidth: maxWidth,
+        accurate: accurate,
+      ),
+    );
+    return response
+        .map(
+          (ThumbnailMessage thumbnail) => VideoThumbnail(
+            position: Duration(milliseconds: thumbnail.position),
+            width: thumbnail.width,
+            height: thumbnail.height,
+            rgba: thumbnail.rgba,
+          ),
+        )
+        .toList();
+  }
+
+  /// Makes the player with [textureId] report its position, buffered range
+  /// and playing state together every [interval], e.g. 250 ms.
+  ///
+  /// While enabled, [getPosition] returns the last reported position without
+  /// querying the player, so progress bars of many players do not each make
+  /// a platform call at every update. [Duration.zero] disables the reports.
+  Future<void> setProgressInterval(int textureId, Duration interval) async {
+    await _api.setProgressInterval(
+      ProgressIntervalMessage(
+        textureId: textureId,
+        intervalMs: interval.inMilliseconds,
+      ),
+    );
+    if (interval == Duration.zero) {
+      _progressTextureIds.remove(textureId);
+      _progressPositions.remove(textureId);
+      _progressIsPlaying.remove(textureId);
+    } else {
+      _progressTextureIds.add(textureId);
+    }
+  }
+
+  CreateMessage _toCreateMessage(DataSource dataSource) {
     String? asset;
     String? packageName;
     String? uri;
@@ -53,16 +163,13 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
       case DataSourceType.contentUri:
         uri = dataSource.uri;
     }
-    final CreateMessage message = CreateMessage(
+    return CreateMessage(
       asset: asset,
       packageName: packageName,
       uri: uri,
       httpHeaders: httpHeaders,
       formatHint: formatHint,
     );
-
-    final TextureMessage response = await _api.create(message);
-    return response.textureId;
   }
 
   @override
@@ -97,14 +204,21 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
   }
 
   @override
-  Future<void> seekTo(int textureId, Duration position) {
-    return _api.seekTo(
+  Future<void> seekTo(int textureId, Duration position) async {
+    await _api.seekTo(
       PositionMessage(textureId: textureId, position: position.inMilliseconds),
     );
+    if (_progressPositions.containsKey(textureId)) {
+      _progressPositions[textureId] = position;
+    }
   }
 
   @override
   Future<Duration> getPosition(int textureId) async {
+    final Duration? position = _progressPositions[textureId];
+    if (position != null) {
+      return position;
+    }
     final PositionMessage response = await _api.position(
       TextureMessage(textureId: textureId),
     );
@@ -113,45 +227,79 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
 
   @override
   Stream<VideoEvent> videoEventsFor(int textureId) {
-    return _eventChannelFor(textureId).receiveBroadcastStream().map((
+    return _eventChannelFor(textureId).receiveBroadcastStream().expand((
       dynamic event,
     ) {
       final Map<dynamic, dynamic> map = event as Map<dynamic, dynamic>;
-      switch (map['event']) {
-        case 'initialized':
-          return VideoEvent(
-            eventType: VideoEventType.initialized,
-            duration: Duration(milliseconds: map['duration'] as int),
-            size: Size(
-              (map['width'] as num?)?.toDouble() ?? 0.0,
-              (map['height'] as num?)?.toDouble() ?? 0.0,
-            ),
-            rotationCorrection: map['rotationCorrection'] as int? ?? 0,
-          );
-        case 'completed':
-          return VideoEvent(eventType: VideoEventType.completed);
-        case 'bufferingUpdate':
-          final List<dynamic> values = map['values'] as List<dynamic>;
-
-          return VideoEvent(
-            buffered: values.map<DurationRange>(_toDurationRange).toList(),
-            eventType: VideoEventType.bufferingUpdate,
-          );
-        case 'bufferingStart':
-          return VideoEvent(eventType: VideoEventType.bufferingStart);
-        case 'bufferingEnd':
-          return VideoEvent(eventType: VideoEventType.bufferingEnd);
-        case 'isPlayingStateUpdate':
-          return VideoEvent(
-            eventType: VideoEventType.isPlayingStateUpdate,
-            isPlaying: map['isPlaying'] as bool,
-          );
-        default:
-          return VideoEvent(eventType: VideoEventType.unknown);
+      if (map['event'] == 'progress') {
+        return _onProgress(textureId, map);
       }
+      return <VideoEvent>[_toVideoEvent(map)];
     });
   }
 
+  Iterable<VideoEvent> _onProgress(int textureId, Map<dynamic, dynamic> map) {
+    // Sent before the reports were disabled.
+    if (!_progressTextureIds.contains(textureId)) {
+      return const <VideoEvent>[];
+    }
+    _progressPositions[textureId] = Duration(
+      milliseconds: map['position'] as int,
+    );
+    final List<dynamic> values = map['values'] as List<dynamic>;
+    final bool isPlaying = map['isPlaying'] as bool;
+    final bool? wasPlaying = _progressIsPlaying[textureId];
+    _progressIsPlaying[textureId] = isPlaying;
+
+    return <VideoEvent>[
+      if (values.isNotEmpty)
+        VideoEvent(
+          buffered: values.map<DurationRange>(_toDurationRange).toList(),
+          eventType: VideoEventType.bufferingUpdate,
+        ),
+      if (isPlaying != wasPlaying)
+        VideoEvent(
+          eventType: VideoEventType.isPlayingStateUpdate,
+          isPlaying: isPlaying,
+        ),
+    ];
+  }
+
+  VideoEvent _toVideoEvent(Map<dynamic, dynamic> map) {
+    switch (map['event']) {
+      case 'initialized':
+        return VideoEvent(
+          eventType: VideoEventType.initialized,
+          duration: Duration(milliseconds: map['duration'] as int),
+          size: Size(
+            (map['width'] as num?)?.toDouble() ?? 0.0,
+            (map['height'] as num?)?.toDouble() ?? 0.0,
+          ),
+          rotationCorrection: map['rotationCorrection'] as int? ?? 0,
+        );
+      case 'completed':
+        return VideoEvent(eventType: VideoEventType.completed);
+      case 'bufferingUpdate':
+        final List<dynamic> values = map['values'] as List<dynamic>;
+
+        return VideoEvent(
+          buffered: values.map<DurationRange>(_toDurationRange).toList(),
+          eventType: VideoEventType.bufferingUpdate,
+        );
+      case 'bufferingStart':
+        return VideoEvent(eventType: VideoEventType.bufferingStart);
+      case 'bufferingEnd':
+        return VideoEvent(eventType: VideoEventType.bufferingEnd);
+      case 'isPlayingStateUpdate':
+        return VideoEvent(
+          eventType: VideoEventType.isPlayingStateUpdate,
+          isPlaying: map['isPlaying'] as bool,
+        );
+      default:
+        return VideoEvent(eventType: VideoEventType.unknown);
+    }
+  }
+
   @override
   Widget buildView(int textureId) {
     return Texture(textureId: textureId);
@@ -164,6 +312,35 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
     );
   }
 
+  /// Returns the frame rendering statistics of the player with [textureId].
+  ///
+  /// The counters are accumulated from the creation of the player.
+  Future<VideoFrameStats> getFrameStats(int textureId) async {
+    final FrameStatsMessage response = await _api.frameStats(
+      TextureMessage(textureId: textureId),
+    );
+    return VideoFrameStats(
+      decoded: response.decoded,
+      presented: response.presented,
+      droppedLate: response.droppedLate,
+      droppedOverflow: response.droppedOverflow,
+      averageRenderLatency: Duration(
+        microseconds: response.averageRenderLatencyUs,
+      ),
+      ringFull: response.ringFull,
+    );
+  }
+
+  /// Sets the number of frames that can be held by the engine at a time for
+  /// players created after this call.
+  ///
+  /// [slotCount] must be between 2 and 8. The default is 3.
+  Future<void> setTextureSlotCount(int slotCount) {
+    return _api.setTextureSlotCount(
+      TextureSlotCountMessage(slotCount: slotCount),
+    );
+  }
+
   EventChannel _eventChannelFor(int textureId) {
     return EventChannel('flutter.io/videoPlayer/videoEvents$textureId');
   }
@@ -184,3 +361,90 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
     );
   }
 }
+
+/// Frame rendering statistics of a video player on Tizen.
+@immutable
+class VideoFrameStats {
+  /// Creates a [VideoFrameStats].
+  const VideoFrameStats({
+    required this.decoded,
+    required this.presented,
+    required this.droppedLate,
+    required this.droppedOverflow,
+    required this.averageRenderLatency,
+    required this.ringFull,
+  });
+
+  /// The number of frames received from the decoder.
+  final int decoded;
+
+  /// The number of frames rendered to the texture.
+  final int presented;
+
+  /// The number of frames skipped because a newer frame was already due.
+  final int droppedLate;
+
+  /// The number of frames discarded because too many frames were queued.
+  final int droppedOverflow;
+
+  /// The average time from a frame being decoded to being rendered.
+  final Duration averageRenderLatency;
+
+  /// The number of times a frame was delayed because all texture slots were
+  /// held by the engine.
+  final int ringFull;
+}
+
+/// Usage statistics of the preloaded player pool on Tizen.
+@immutable
+class VideoPreloadStats {
+  /// Creates a [VideoPreloadStats].
+  const VideoPreloadStats({
+    required this.size,
+    required this.maxSize,
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+  });
+
+  /// The number of players currently in the pool.
+  final int size;
+
+  /// The maximum number of players in the pool.
+  final int maxSize;
+
+  /// The number of players created from the pool.
+  final int hits;
+
+  /// The number of players created while the pool had no player for the
+  /// source.
+  final int misses;
+
+  /// The number of preloaded players disposed without being used.
+  final int evictions;
+}
+
+/// A video frame decoded by [VideoPlayerTizen.getThumbnails].
+@immutable
+class VideoThumbnail {
+  /// Creates a [VideoThumbnail].
+  const VideoThumbnail({
+    required this.position,
+    required this.width,
+    required this.height,
+    required this.rgba,
+  });
+
+  /// The requested position of the frame.
+  final Duration position;
+
+  /// The width of the image in pixels.
+  final int width;
+
+  /// The height of the image in pixels.
+  final int height;
+
+  /// The pixels of the image in RGBA8888 format, e.g. for
+  /// `decodeImageFromPixels`.
+  final Uint8List rgba;
+}
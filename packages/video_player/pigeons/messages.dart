@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:typed_data';
+
 import 'package:pigeon/pigeon.dart';
 
 @ConfigurePigeon(
@@ -55,6 +57,77 @@ class MixWithOthersMessage {
   bool mixWithOthers;
 }
 
+class FrameStatsMessage {
+  FrameStatsMessage(
+    this.textureId,
+    this.decoded,
+    this.presented,
+    this.droppedLate,
+    this.droppedOverflow,
+    this.averageRenderLatencyUs,
+    this.ringFull,
+  );
+  int textureId;
+  int decoded;
+  int presented;
+  int droppedLate;
+  int droppedOverflow;
+  int averageRenderLatencyUs;
+  int ringFull;
+}
+
+class TextureSlotCountMessage {
+  TextureSlotCountMessage(this.slotCount);
+  int slotCount;
+}
+
+class PreloadPoolSizeMessage {
+  PreloadPoolSizeMessage(this.maxSize);
+  int maxSize;
+}
+
+class PreloadStatsMessage {
+  PreloadStatsMessage(
+    this.size,
+    this.maxSize,
+    this.hits,
+    this.misses,
+    this.evictions,
+  );
+  int size;
+  int maxSize;
+  int hits;
+  int misses;
+  int evictions;
+}
+
+class ProgressIntervalMessage {
+  ProgressIntervalMessage(this.textureId, this.intervalMs);
+  int textureId;
+  int intervalMs;
+}
+
+class ThumbnailRequestMessage {
+  ThumbnailRequestMessage(
+    this.textureId,
+    this.positions,
+    this.maxWidth,
+    this.accurate,
+  );
+  int textureId;
+  List<int> positions;
+  int maxWidth;
+  bool accurate;
+}
+
+class ThumbnailMessage {
+  ThumbnailMessage(this.position, this.width, this.height, this.rgba);
+  int position;
+  int width;
+  int height;
+  Uint8List rgba;
+}
+
 @HostApi()
 abstract class TizenVideoPlayerApi {
   void initialize();
@@ -69,4 +142,12 @@ abstract class TizenVideoPlayerApi {
   void seekTo(PositionMessage msg);
   void pause(TextureMessage msg);
   void setMixWithOthers(MixWithOthersMessage msg);
+  FrameStatsMessage frameStats(TextureMessage msg);
+  void setTextureSlotCount(TextureSlotCountMessage msg);
+  void preload(CreateMessage msg);
+  void setPreloadPoolSize(PreloadPoolSizeMessage msg);
+  PreloadStatsMessage preloadStats();
+  void setProgressInterval(ProgressIntervalMessage msg);
+  @async
+  List<ThumbnailMessage> thumbnails(ThumbnailRequestMessage msg);
 }
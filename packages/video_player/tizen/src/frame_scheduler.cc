@@ -0,0 +1,126 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_scheduler.h"
+
+#include <algorithm>
+
+namespace video_player_tizen {
+
+namespace {
+
+// Frames are decoded ahead of time in bursts, but holding more than a few of
+// them only delays the display and keeps decoder buffers busy.
+constexpr size_t kMaxQueuedFrames = 4;
+
+// The clock is re-anchored when a frame is this far off the expected time,
+// e.g. after a discontinuity in the stream.
+constexpr auto kMaxClockDrift = std::chrono::seconds(1);
+
+}  // namespace
+
+FrameScheduler::~FrameScheduler() { Flush(); }
+
+void FrameScheduler::PushFrame(media_packet_h packet) {
+  Clock::time_point now = Clock::now();
+  decoded_count_++;
+  if (frames_.size() >= kMaxQueuedFrames) {
+    media_packet_destroy(frames_.front().packet);
+    frames_.pop_front();
+    dropped_overflow_count_++;
+  }
+  frames_.push_back(Frame{packet, now, GetDueTime(packet, now)});
+}
+
+// A frame is presented if it is due before the middle of the next refresh
+// interval.
+FrameScheduler::Clock::duration FrameScheduler::GetVsyncTolerance() const {
+  return vsync_interval_ / 2;
+}
+
+bool FrameScheduler::HasFrameToPresent() const {
+  return !frames_.empty() &&
+         frames_.front().due_time <= Clock::now() + GetVsyncTolerance();
+}
+
+FrameScheduler::Clock::duration FrameScheduler::GetRenderRequestDelay() const {
+  if (frames_.empty()) {
+    return Clock::duration::zero();
+  }
+  Clock::duration delay = frames_.front().due_time - GetVsyncTolerance() -
+                          vsync_interval_ - Clock::now();
+  return std::max(delay, Clock::duration::zero());
+}
+
+media_packet_h FrameScheduler::PopFrameToPresent() {
+  Clock::time_point now = Clock::now();
+  Clock::time_point deadline = now + GetVsyncTolerance();
+  if (frames_.empty() || frames_.front().due_time > deadline) {
+    return nullptr;
+  }
+  while (frames_.size() > 1 && frames_[1].due_time <= deadline) {
+    media_packet_destroy(frames_.front().packet);
+    frames_.pop_front();
+    dropped_late_count_++;
+  }
+  Frame frame = frames_.front();
+  frames_.pop_front();
+  presented_count_++;
+  total_render_latency_ += now - frame.decoded_time;
+  return frame.packet;
+}
+
+void FrameScheduler::Flush() {
+  while (!frames_.empty()) {
+    media_packet_destroy(frames_.front().packet);
+    frames_.pop_front();
+  }
+  ResetClock();
+}
+
+void FrameScheduler::SetPlaybackRate(double rate) {
+  if (rate > 0 && rate != playback_rate_) {
+    playback_rate_ = rate;
+    ResetClock();
+  }
+}
+
+FrameStats FrameScheduler::GetStats() const {
+  FrameStats stats;
+  stats.decoded = decoded_count_;
+  stats.presented = presented_count_;
+  stats.dropped_late = dropped_late_count_;
+  stats.dropped_overflow = dropped_overflow_count_;
+  if (presented_count_ > 0) {
+    stats.average_render_latency_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            total_render_latency_)
+            .count() /
+        presented_count_;
+  }
+  return stats;
+}
+
+FrameScheduler::Clock::time_point FrameScheduler::GetDueTime(
+    media_packet_h packet, Clock::time_point now) {
+  uint64_t pts_ns = 0;
+  if (media_packet_get_pts(packet, &pts_ns) != MEDIA_PACKET_ERROR_NONE) {
+    return now;
+  }
+  if (is_anchored_ && pts_ns >= anchor_pts_ns_) {
+    auto offset = std::chrono::nanoseconds(
+        static_cast<int64_t>((pts_ns - anchor_pts_ns_) / playback_rate_));
+    Clock::time_point due_time =
+        anchor_time_ + std::chrono::duration_cast<Clock::duration>(offset);
+    if (due_time - now <= kMaxClockDrift && now - due_time <= kMaxClockDrift) {
+      return due_time;
+    }
+  }
+  is_anchored_ = true;
+  anchor_pts_ns_ = pts_ns;
+  anchor_time_ = now;
+  return now;
+}
+
+}  // namespace video_player_tizen
@@ -0,0 +1,111 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_FRAME_SCHEDULER_H_
+#define FLUTTER_PLUGIN_FRAME_SCHEDULER_H_
+
+#include <media_packet.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+
+namespace video_player_tizen {
+
+struct FrameStats {
+  int64_t decoded = 0;
+  int64_t presented = 0;
+  // Frames that were superseded by a newer frame already due for display.
+  int64_t dropped_late = 0;
+  // Frames that were discarded because the queue was full.
+  int64_t dropped_overflow = 0;
+  // The average time from a frame being decoded to being presented.
+  int64_t average_render_latency_us = 0;
+  // Frames that were due but delayed because the engine held all texture
+  // slots.
+  int64_t ring_full = 0;
+};
+
+// Queues decoded video frames and picks the one to present at each vsync
+// based on the presentation timestamps of the frames.
+//
+// The timestamps are mapped to the monotonic clock using the first frame
+// received after a reset as the anchor. This class is not thread-safe.
+class FrameScheduler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // The refresh interval of a 60 Hz display, assumed until another one is
+  // set.
+  static constexpr Clock::duration kDefaultVsyncInterval =
+      std::chrono::microseconds(16667);
+
+  FrameScheduler() = default;
+  ~FrameScheduler();
+
+  FrameScheduler(const FrameScheduler &) = delete;
+  FrameScheduler &operator=(const FrameScheduler &) = delete;
+
+  // Takes the ownership of |packet|.
+  void PushFrame(media_packet_h packet);
+
+  // Returns the newest frame that is due for display by the next vsync and
+  // destroys the older ones, or nullptr if no frame is due yet. The caller
+  // takes the ownership of the returned packet.
+  media_packet_h PopFrameToPresent();
+
+  bool HasFrames() const { return !frames_.empty(); }
+
+  // Whether PopFrameToPresent() would return a frame.
+  bool HasFrameToPresent() const;
+
+  // Returns how long to wait before asking the engine to draw, so that the
+  // oldest queued frame is due by the vsync that follows. Returns zero if the
+  // engine should be asked now.
+  Clock::duration GetRenderRequestDelay() const;
+
+  // Destroys all queued frames and resets the clock.
+  void Flush();
+
+  // Re-anchors the clock on the next frame, e.g. when playback resumes.
+  void ResetClock() { is_anchored_ = false; }
+
+  void SetPlaybackRate(double rate);
+
+  // Sets the refresh interval of the display, by which frames are picked.
+  void SetVsyncInterval(Clock::duration interval) {
+    vsync_interval_ = interval;
+  }
+
+  FrameStats GetStats() const;
+
+ private:
+  struct Frame {
+    media_packet_h packet;
+    Clock::time_point decoded_time;
+    Clock::time_point due_time;
+  };
+
+  Clock::time_point GetDueTime(media_packet_h packet, Clock::time_point now);
+  Clock::duration GetVsyncTolerance() const;
+
+  std::deque<Frame> frames_;
+
+  Clock::duration vsync_interval_ = kDefaultVsyncInterval;
+
+  bool is_anchored_ = false;
+  uint64_t anchor_pts_ns_ = 0;
+  Clock::time_point anchor_time_;
+  double playback_rate_ = 1.0;
+
+  int64_t decoded_count_ = 0;
+  int64_t presented_count_ = 0;
+  int64_t dropped_late_count_ = 0;
+  int64_t dropped_overflow_count_ = 0;
+  Clock::duration total_render_latency_{0};
+};
+
+}  // namespace video_player_tizen
+
+#endif  // FLUTTER_PLUGIN_FRAME_SCHEDULER_H_
@@ -296,6 +296,326 @@ MixWithOthersMessage MixWithOthersMessage::FromEncodableList(
   return decoded;
 }
 
+// FrameStatsMessage
+
+FrameStatsMessage::FrameStatsMessage(int64_t texture_id, int64_t decoded,
+                                     int64_t presented, int64_t dropped_late,
+                                     int64_t dropped_overflow,
+                                     int64_t average_render_latency_us,
+                                     int64_t ring_full)
+    : texture_id_(texture_id),
+      decoded_(decoded),
+      presented_(presented),
+      dropped_late_(dropped_late),
+      dropped_overflow_(dropped_overflow),
+      average_render_latency_us_(average_render_latency_us),
+      ring_full_(ring_full) {}
+
+int64_t FrameStatsMessage::texture_id() const { return texture_id_; }
+
+void FrameStatsMessage::set_texture_id(int64_t value_arg) {
+  texture_id_ = value_arg;
+}
+
+int64_t FrameStatsMessage::decoded() const { return decoded_; }
+
+void FrameStatsMessage::set_decoded(int64_t value_arg) { decoded_ = value_arg; }
+
+int64_t FrameStatsMessage::presented() const { return presented_; }
+
+void FrameStatsMessage::set_presented(int64_t value_arg) {
+  presented_ = value_arg;
+}
+
+int64_t FrameStatsMessage::dropped_late() const { return dropped_late_; }
+
+void FrameStatsMessage::set_dropped_late(int64_t value_arg) {
+  dropped_late_ = value_arg;
+}
+
+int64_t FrameStatsMessage::dropped_overflow() const {
+  return dropped_overflow_;
+}
+
+void FrameStatsMessage::set_dropped_overflow(int64_t value_arg) {
+  dropped_overflow_ = value_arg;
+}
+
+int64_t FrameStatsMessage::average_render_latency_us() const {
+  return average_render_latency_us_;
+}
+
+void FrameStatsMessage::set_average_render_latency_us(int64_t value_arg) {
+  average_render_latency_us_ = value_arg;
+}
+
+int64_t FrameStatsMessage::ring_full() const { return ring_full_; }
+
+void FrameStatsMessage::set_ring_full(int64_t value_arg) {
+  ring_full_ = value_arg;
+}
+
+EncodableList FrameStatsMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(7);
+  list.push_back(EncodableValue(texture_id_));
+  list.push_back(EncodableValue(decoded_));
+  list.push_back(EncodableValue(presented_));
+  list.push_back(EncodableValue(dropped_late_));
+  list.push_back(EncodableValue(dropped_overflow_));
+  list.push_back(EncodableValue(average_render_latency_us_));
+  list.push_back(EncodableValue(ring_full_));
+  return list;
+}
+
+FrameStatsMessage FrameStatsMessage::FromEncodableList(
+    const EncodableList& list) {
+  FrameStatsMessage decoded(
+      std::get<int64_t>(list[0]), std::get<int64_t>(list[1]),
+      std::get<int64_t>(list[2]), std::get<int64_t>(list[3]),
+      std::get<int64_t>(list[4]), std::get<int64_t>(list[5]),
+      std::get<int64_t>(list[6]));
+  return decoded;
+}
+
+// TextureSlotCountMessage
+
+TextureSlotCountMessage::TextureSlotCountMessage(int64_t slot_count)
+    : slot_count_(slot_count) {}
+
+int64_t TextureSlotCountMessage::slot_count() const { return slot_count_; }
+
+void TextureSlotCountMessage::set_slot_count(int64_t value_arg) {
+  slot_count_ = value_arg;
+}
+
+EncodableList TextureSlotCountMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(1);
+  list.push_back(EncodableValue(slot_count_));
+  return list;
+}
+
+TextureSlotCountMessage TextureSlotCountMessage::FromEncodableList(
+    const EncodableList& list) {
+  TextureSlotCountMessage decoded(std::get<int64_t>(list[0]));
+  return decoded;
+}
+
+// PreloadPoolSizeMessage
+
+PreloadPoolSizeMessage::PreloadPoolSizeMessage(int64_t max_size)
+    : max_size_(max_size) {}
+
+int64_t PreloadPoolSizeMessage::max_size() const { return max_size_; }
+
+void PreloadPoolSizeMessage::set_max_size(int64_t value_arg) {
+  max_size_ = value_arg;
+}
+
+EncodableList PreloadPoolSizeMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(1);
+  list.push_back(EncodableValue(max_size_));
+  return list;
+}
+
+PreloadPoolSizeMessage PreloadPoolSizeMessage::FromEncodableList(
+    const EncodableList& list) {
+  PreloadPoolSizeMessage decoded(std::get<int64_t>(list[0]));
+  return decoded;
+}
+
+// PreloadStatsMessage
+
+PreloadStatsMessage::PreloadStatsMessage(
+    int64_t size, int64_t max_size, int64_t hits, int64_t misses,
+    int64_t evictions)
+    : size_(size),
+      max_size_(max_size),
+      hits_(hits),
+      misses_(misses),
+      evictions_(evictions) {}
+
+int64_t PreloadStatsMessage::size() const { return size_; }
+
+void PreloadStatsMessage::set_size(int64_t value_arg) { size_ = value_arg; }
+
+int64_t PreloadStatsMessage::max_size() const { return max_size_; }
+
+void PreloadStatsMessage::set_max_size(int64_t value_arg) {
+  max_size_ = value_arg;
+}
+
+int64_t PreloadStatsMessage::hits() const { return hits_; }
+
+void PreloadStatsMessage::set_hits(int64_t value_arg) { hits_ = value_arg; }
+
+int64_t PreloadStatsMessage::misses() const { return misses_; }
+
+void PreloadStatsMessage::set_misses(int64_t value_arg) { misses_ = value_arg; }
+
+int64_t PreloadStatsMessage::evictions() const { return evictions_; }
+
+void PreloadStatsMessage::set_evictions(int64_t value_arg) {
+  evictions_ = value_arg;
+}
+
+EncodableList PreloadStatsMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(5);
+  list.push_back(EncodableValue(size_));
+  list.push_back(EncodableValue(max_size_));
+  list.push_back(EncodableValue(hits_));
+  list.push_back(EncodableValue(misses_));
+  list.push_back(EncodableValue(evictions_));
+  return list;
+}
+
+PreloadStatsMessage PreloadStatsMessage::FromEncodableList(
+    const EncodableList& list) {
+  PreloadStatsMessage decoded(std::get<int64_t>(list[0]),
+                              std::get<int64_t>(list[1]),
+                              std::get<int64_t>(list[2]),
+                              std::get<int64_t>(list[3]),
+                              std::get<int64_t>(list[4]));
+  return decoded;
+}
+
+// ProgressIntervalMessage
+
+ProgressIntervalMessage::ProgressIntervalMessage(
+    int64_t texture_id, int64_t interval_ms)
+    : texture_id_(texture_id), interval_ms_(interval_ms) {}
+
+int64_t ProgressIntervalMessage::texture_id() const { return texture_id_; }
+
+void ProgressIntervalMessage::set_texture_id(int64_t value_arg) {
+  texture_id_ = value_arg;
+}
+
+int64_t ProgressIntervalMessage::interval_ms() const { return interval_ms_; }
+
+void ProgressIntervalMessage::set_interval_ms(int64_t value_arg) {
+  interval_ms_ = value_arg;
+}
+
+EncodableList ProgressIntervalMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(texture_id_));
+  list.push_back(EncodableValue(interval_ms_));
+  return list;
+}
+
+ProgressIntervalMessage ProgressIntervalMessage::FromEncodableList(
+    const EncodableList& list) {
+  ProgressIntervalMessage decoded(std::get<int64_t>(list[0]),
+                                  std::get<int64_t>(list[1]));
+  return decoded;
+}
+
+// ThumbnailRequestMessage
+
+ThumbnailRequestMessage::ThumbnailRequestMessage(
+    int64_t texture_id, const EncodableList& positions, int64_t max_width,
+    bool accurate)
+    : texture_id_(texture_id),
+      positions_(positions),
+      max_width_(max_width),
+      accurate_(accurate) {}
+
+int64_t ThumbnailRequestMessage::texture_id() const { return texture_id_; }
+
+void ThumbnailRequestMessage::set_texture_id(int64_t value_arg) {
+  texture_id_ = value_arg;
+}
+
+const EncodableList& ThumbnailRequestMessage::positions() const {
+  return positions_;
+}
+
+void ThumbnailRequestMessage::set_positions(const EncodableList& value_arg) {
+  positions_ = value_arg;
+}
+
+int64_t ThumbnailRequestMessage::max_width() const { return max_width_; }
+
+void ThumbnailRequestMessage::set_max_width(int64_t value_arg) {
+  max_width_ = value_arg;
+}
+
+bool ThumbnailRequestMessage::accurate() const { return accurate_; }
+
+void ThumbnailRequestMessage::set_accurate(bool value_arg) {
+  accurate_ = value_arg;
+}
+
+EncodableList ThumbnailRequestMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(texture_id_));
+  list.push_back(EncodableValue(positions_));
+  list.push_back(EncodableValue(max_width_));
+  list.push_back(EncodableValue(accurate_));
+  return list;
+}
+
+ThumbnailRequestMessage ThumbnailRequestMessage::FromEncodableList(
+    const EncodableList& list) {
+  ThumbnailRequestMessage decoded(std::get<int64_t>(list[0]),
+                                  std::get<EncodableList>(list[1]),
+                                  std::get<int64_t>(list[2]),
+                                  std::get<bool>(list[3]));
+  return decoded;
+}
+
+// ThumbnailMessage
+
+ThumbnailMessage::ThumbnailMessage(int64_t position, int64_t width,
+                                   int64_t height,
+                                   const std::vector<uint8_t>& rgba)
+    : position_(position), width_(width), height_(height), rgba_(rgba) {}
+
+int64_t ThumbnailMessage::position() const { return position_; }
+
+void ThumbnailMessage::set_position(int64_t value_arg) {
+  position_ = value_arg;
+}
+
+int64_t ThumbnailMessage::width() const { return width_; }
+
+void ThumbnailMessage::set_width(int64_t value_arg) { width_ = value_arg; }
+
+int64_t ThumbnailMessage::height() const { return height_; }
+
+void ThumbnailMessage::set_height(int64_t value_arg) { height_ = value_arg; }
+
+const std::vector<uint8_t>& ThumbnailMessage::rgba() const { return rgba_; }
+
+void ThumbnailMessage::set_rgba(const std::vector<uint8_t>& value_arg) {
+  rgba_ = value_arg;
+}
+
+EncodableList ThumbnailMessage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(position_));
+  list.push_back(EncodableValue(width_));
+  list.push_back(EncodableValue(height_));
+  list.push_back(EncodableValue(rgba_));
+  return list;
+}
+
+ThumbnailMessage ThumbnailMessage::FromEncodableList(
+    const EncodableList& list) {
+  ThumbnailMessage decoded(std::get<int64_t>(list[0]),
+                           std::get<int64_t>(list[1]),
+                           std::get<int64_t>(list[2]),
+                           std::get<std::vector<uint8_t>>(list[3]));
+  return decoded;
+}
+
 PigeonInternalCodecSerializer::PigeonInternalCodecSerializer() {}
 
 EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
@@ -329,6 +649,34 @@ EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
       return CustomEncodableValue(MixWithOthersMessage::FromEncodableList(
           std::get<EncodableList>(ReadValue(stream))));
     }
+    case 136: {
+      return CustomEncodableValue(FrameStatsMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
+    case 137: {
+      return CustomEncodableValue(TextureSlotCountMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
+    case 138: {
+      return CustomEncodableValue(PreloadPoolSizeMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
+    case 139: {
+      return CustomEncodableValue(PreloadStatsMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
+    case 140: {
+      return CustomEncodableValue(ProgressIntervalMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
+    case 141: {
+      return CustomEncodableValue(ThumbnailRequestMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
+    case 142: {
+      return CustomEncodableValue(ThumbnailMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    }
     default:
       return flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
   }
@@ -394,6 +742,62 @@ void PigeonInternalCodecSerializer::WriteValue(
           stream);
       return;
     }
+    if (custom_value->type() == typeid(FrameStatsMessage)) {
+      stream->WriteByte(136);
+      WriteValue(
+          EncodableValue(std::any_cast<FrameStatsMessage>(*custom_value)
+                             .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TextureSlotCountMessage)) {
+      stream->WriteByte(137);
+      WriteValue(
+          EncodableValue(std::any_cast<TextureSlotCountMessage>(*custom_value)
+                             .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PreloadPoolSizeMessage)) {
+      stream->WriteByte(138);
+      WriteValue(
+          EncodableValue(std::any_cast<PreloadPoolSizeMessage>(*custom_value)
+                             .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PreloadStatsMessage)) {
+      stream->WriteByte(139);
+      WriteValue(
+          EncodableValue(std::any_cast<PreloadStatsMessage>(*custom_value)
+                             .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ProgressIntervalMessage)) {
+      stream->WriteByte(140);
+      WriteValue(
+          EncodableValue(std::any_cast<ProgressIntervalMessage>(*custom_value)
+                             .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ThumbnailRequestMessage)) {
+      stream->WriteByte(141);
+      WriteValue(
+          EncodableValue(std::any_cast<ThumbnailRequestMessage>(*custom_value)
+                             .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ThumbnailMessage)) {
+      stream->WriteByte(142);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<ThumbnailMessage>(*custom_value).ToEncodableList()),
+          stream);
+      return;
+    }
   }
   flutter::StandardCodecSerializer::WriteValue(value, stream);
 }
@@ -801,6 +1205,255 @@ void TizenVideoPlayerApi::SetUp(flutter::BinaryMessenger* binary_messenger,
       channel.SetMessageHandler(nullptr);
     }
   }
+  {
+    BasicMessageChannel<> channel(binary_messenger,
+                                  "dev.flutter.pigeon.video_player_tizen."
+                                  "TizenVideoPlayerApi.frameStats" +
+                                      prepended_suffix,
+                                  &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_msg_arg = args.at(0);
+              if (encodable_msg_arg.IsNull()) {
+                reply(WrapError("msg_arg unexpectedly null."));
+                return;
+              }
+              const auto& msg_arg = std::any_cast<const TextureMessage&>(
+                  std::get<CustomEncodableValue>(encodable_msg_arg));
+              ErrorOr<FrameStatsMessage> output = api->FrameStats(msg_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(
+                  CustomEncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger,
+                                  "dev.flutter.pigeon.video_player_tizen."
+                                  "TizenVideoPlayerApi.setTextureSlotCount" +
+                                      prepended_suffix,
+                                  &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_msg_arg = args.at(0);
+              if (encodable_msg_arg.IsNull()) {
+                reply(WrapError("msg_arg unexpectedly null."));
+                return;
+              }
+              const auto& msg_arg =
+                  std::any_cast<const TextureSlotCountMessage&>(
+                      std::get<CustomEncodableValue>(encodable_msg_arg));
+              std::optional<FlutterError> output =
+                  api->SetTextureSlotCount(msg_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(
+        binary_messenger,
+        "dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.preload" +
+            prepended_suffix,
+        &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_msg_arg = args.at(0);
+              if (encodable_msg_arg.IsNull()) {
+                reply(WrapError("msg_arg unexpectedly null."));
+                return;
+              }
+              const auto& msg_arg = std::any_cast<const CreateMessage&>(
+                  std::get<CustomEncodableValue>(encodable_msg_arg));
+              std::optional<FlutterError> output = api->Preload(msg_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger,
+                                  "dev.flutter.pigeon.video_player_tizen."
+                                  "TizenVideoPlayerApi.setPreloadPoolSize" +
+                                      prepended_suffix,
+                                  &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_msg_arg = args.at(0);
+              if (encodable_msg_arg.IsNull()) {
+                reply(WrapError("msg_arg unexpectedly null."));
+                return;
+              }
+              const auto& msg_arg =
+                  std::any_cast<const PreloadPoolSizeMessage&>(
+                      std::get<CustomEncodableValue>(encodable_msg_arg));
+              std::optional<FlutterError> output =
+                  api->SetPreloadPoolSize(msg_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger,
+                                  "dev.flutter.pigeon.video_player_tizen."
+                                  "TizenVideoPlayerApi.preloadStats" +
+                                      prepended_suffix,
+                                  &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              ErrorOr<PreloadStatsMessage> output = api->PreloadStats();
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(
+                  CustomEncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger,
+                                  "dev.flutter.pigeon.video_player_tizen."
+                                  "TizenVideoPlayerApi.setProgressInterval" +
+                                      prepended_suffix,
+                                  &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_msg_arg = args.at(0);
+              if (encodable_msg_arg.IsNull()) {
+                reply(WrapError("msg_arg unexpectedly null."));
+                return;
+              }
+              const auto& msg_arg =
+                  std::any_cast<const ProgressIntervalMessage&>(
+                      std::get<CustomEncodableValue>(encodable_msg_arg));
+              std::optional<FlutterError> output =
+                  api->SetProgressInterval(msg_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(
+        binary_messenger,
+        "dev.flutter.pigeon.video_player_tizen.TizenVideoPlayerApi.thumbnails" +
+            prepended_suffix,
+        &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_msg_arg = args.at(0);
+              if (encodable_msg_arg.IsNull()) {
+                reply(WrapError("msg_arg unexpectedly null."));
+                return;
+              }
+              const auto& msg_arg =
+                  std::any_cast<const ThumbnailRequestMessage&>(
+                      std::get<CustomEncodableValue>(encodable_msg_arg));
+              api->Thumbnails(
+                  msg_arg, [reply](ErrorOr<EncodableList>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
 }
 
 EncodableValue TizenVideoPlayerApi::WrapError(std::string_view error_message) {
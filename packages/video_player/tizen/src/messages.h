@@ -218,6 +218,207 @@ class MixWithOthersMessage {
   bool mix_with_others_;
 };
 
+// Generated class from Pigeon that represents data sent in messages.
+class FrameStatsMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit FrameStatsMessage(int64_t texture_id, int64_t decoded,
+                             int64_t presented, int64_t dropped_late,
+                             int64_t dropped_overflow,
+                             int64_t average_render_latency_us,
+                             int64_t ring_full);
+
+  int64_t texture_id() const;
+  void set_texture_id(int64_t value_arg);
+
+  int64_t decoded() const;
+  void set_decoded(int64_t value_arg);
+
+  int64_t presented() const;
+  void set_presented(int64_t value_arg);
+
+  int64_t dropped_late() const;
+  void set_dropped_late(int64_t value_arg);
+
+  int64_t dropped_overflow() const;
+  void set_dropped_overflow(int64_t value_arg);
+
+  int64_t average_render_latency_us() const;
+  void set_average_render_latency_us(int64_t value_arg);
+
+  int64_t ring_full() const;
+  void set_ring_full(int64_t value_arg);
+
+ private:
+  static FrameStatsMessage FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t texture_id_;
+  int64_t decoded_;
+  int64_t presented_;
+  int64_t dropped_late_;
+  int64_t dropped_overflow_;
+  int64_t average_render_latency_us_;
+  int64_t ring_full_;
+};
+
+// Generated class from Pigeon that represents data sent in messages.
+class TextureSlotCountMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit TextureSlotCountMessage(int64_t slot_count);
+
+  int64_t slot_count() const;
+  void set_slot_count(int64_t value_arg);
+
+ private:
+  static TextureSlotCountMessage FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t slot_count_;
+};
+
+// Generated class from Pigeon that represents data sent in messages.
+class PreloadPoolSizeMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit PreloadPoolSizeMessage(int64_t max_size);
+
+  int64_t max_size() const;
+  void set_max_size(int64_t value_arg);
+
+ private:
+  static PreloadPoolSizeMessage FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t max_size_;
+};
+
+// Generated class from Pigeon that represents data sent in messages.
+class PreloadStatsMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit PreloadStatsMessage(int64_t size, int64_t max_size, int64_t hits,
+                               int64_t misses, int64_t evictions);
+
+  int64_t size() const;
+  void set_size(int64_t value_arg);
+
+  int64_t max_size() const;
+  void set_max_size(int64_t value_arg);
+
+  int64_t hits() const;
+  void set_hits(int64_t value_arg);
+
+  int64_t misses() const;
+  void set_misses(int64_t value_arg);
+
+  int64_t evictions() const;
+  void set_evictions(int64_t value_arg);
+
+ private:
+  static PreloadStatsMessage FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t size_;
+  int64_t max_size_;
+  int64_t hits_;
+  int64_t misses_;
+  int64_t evictions_;
+};
+
+// Generated class from Pigeon that represents data sent in messages.
+class ProgressIntervalMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit ProgressIntervalMessage(int64_t texture_id, int64_t interval_ms);
+
+  int64_t texture_id() const;
+  void set_texture_id(int64_t value_arg);
+
+  int64_t interval_ms() const;
+  void set_interval_ms(int64_t value_arg);
+
+ private:
+  static ProgressIntervalMessage FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t texture_id_;
+  int64_t interval_ms_;
+};
+
+// Generated class from Pigeon that represents data sent in messages.
+class ThumbnailRequestMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit ThumbnailRequestMessage(int64_t texture_id,
+                                   const flutter::EncodableList& positions,
+                                   int64_t max_width, bool accurate);
+
+  int64_t texture_id() const;
+  void set_texture_id(int64_t value_arg);
+
+  const flutter::EncodableList& positions() const;
+  void set_positions(const flutter::EncodableList& value_arg);
+
+  int64_t max_width() const;
+  void set_max_width(int64_t value_arg);
+
+  bool accurate() const;
+  void set_accurate(bool value_arg);
+
+ private:
+  static ThumbnailRequestMessage FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t texture_id_;
+  flutter::EncodableList positions_;
+  int64_t max_width_;
+  bool accurate_;
+};
+
+// Generated class from Pigeon that represents data sent in messages.
+class ThumbnailMessage {
+ public:
+  // Constructs an object setting all fields.
+  explicit ThumbnailMessage(int64_t position, int64_t width, int64_t height,
+                            const std::vector<uint8_t>& rgba);
+
+  int64_t position() const;
+  void set_position(int64_t value_arg);
+
+  int64_t width() const;
+  void set_width(int64_t value_arg);
+
+  int64_t height() const;
+  void set_height(int64_t value_arg);
+
+  const std::vector<uint8_t>& rgba() const;
+  void set_rgba(const std::vector<uint8_t>& value_arg);
+
+ private:
+  static ThumbnailMessage FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class TizenVideoPlayerApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t position_;
+  int64_t width_;
+  int64_t height_;
+  std::vector<uint8_t> rgba_;
+};
+
 class PigeonInternalCodecSerializer : public flutter::StandardCodecSerializer {
  public:
   PigeonInternalCodecSerializer();
@@ -256,6 +457,18 @@ class TizenVideoPlayerApi {
   virtual std::optional<FlutterError> Pause(const TextureMessage& msg) = 0;
   virtual std::optional<FlutterError> SetMixWithOthers(
       const MixWithOthersMessage& msg) = 0;
+  virtual ErrorOr<FrameStatsMessage> FrameStats(const TextureMessage& msg) = 0;
+  virtual std::optional<FlutterError> SetTextureSlotCount(
+      const TextureSlotCountMessage& msg) = 0;
+  virtual std::optional<FlutterError> Preload(const CreateMessage& msg) = 0;
+  virtual std::optional<FlutterError> SetPreloadPoolSize(
+      const PreloadPoolSizeMessage& msg) = 0;
+  virtual ErrorOr<PreloadStatsMessage> PreloadStats() = 0;
+  virtual std::optional<FlutterError> SetProgressInterval(
+      const ProgressIntervalMessage& msg) = 0;
+  virtual void Thumbnails(
+      const ThumbnailRequestMessage& msg,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
 
   // The codec used by TizenVideoPlayerApi.
   static const flutter::StandardMessageCodec& GetCodec();
@@ -0,0 +1,93 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "player_pool.h"
+
+#include "log.h"
+
+namespace video_player_tizen {
+
+PlayerPool::~PlayerPool() { Clear(); }
+
+void PlayerPool::SetMaxSize(size_t max_size) {
+  max_size_ = max_size;
+  while (entries_.size() > max_size_) {
+    EvictOldest();
+  }
+}
+
+bool PlayerPool::Touch(const std::string &uri) {
+  for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+    if (iter->first == uri) {
+      entries_.splice(entries_.begin(), entries_, iter);
+      return true;
+    }
+  }
+  return false;
+}
+
+void PlayerPool::Add(const std::string &uri,
+                     std::unique_ptr<VideoPlayer> player) {
+  if (max_size_ == 0) {
+    player->Dispose();
+    return;
+  }
+  while (entries_.size() >= max_size_) {
+    EvictOldest();
+  }
+  entries_.emplace_front(uri, std::move(player));
+}
+
+std::unique_ptr<VideoPlayer> PlayerPool::Take(const std::string &uri) {
+  for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+    if (iter->first != uri) {
+      continue;
+    }
+    std::unique_ptr<VideoPlayer> player = std::move(iter->second);
+    entries_.erase(iter);
+    // A player that failed while waiting in the pool, e.g. because its
+    // decoder was taken by another application, is not reused.
+    if (player->HasError()) {
+      LOG_INFO("[PlayerPool] Discarding failed player for %s.", uri.c_str());
+      player->Dispose();
+      break;
+    }
+    hits_++;
+    return player;
+  }
+  if (max_size_ > 0) {
+    misses_++;
+  }
+  return nullptr;
+}
+
+void PlayerPool::Clear() {
+  for (auto &[uri, player] : entries_) {
+    player->Dispose();
+  }
+  entries_.clear();
+}
+
+PlayerPoolStats PlayerPool::GetStats() const {
+  PlayerPoolStats stats;
+  stats.size = entries_.size();
+  stats.max_size = max_size_;
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.evictions = evictions_;
+  return stats;
+}
+
+void PlayerPool::EvictOldest() {
+  if (entries_.empty()) {
+    return;
+  }
+  LOG_DEBUG("[PlayerPool] Evicting player for %s.",
+            entries_.back().first.c_str());
+  entries_.back().second->Dispose();
+  entries_.pop_back();
+  evictions_++;
+}
+
+}  // namespace video_player_tizen
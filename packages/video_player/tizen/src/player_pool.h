@@ -0,0 +1,78 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_PLAYER_POOL_H_
+#define FLUTTER_PLUGIN_PLAYER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "video_player.h"
+
+namespace video_player_tizen {
+
+struct PlayerPoolStats {
+  int64_t size = 0;
+  int64_t max_size = 0;
+  int64_t hits = 0;
+  int64_t misses = 0;
+  int64_t evictions = 0;
+};
+
+// Keeps players that were created ahead of time for the URIs likely to be
+// played next, so that they are already prepared when requested.
+//
+// When the pool is full, the least recently preloaded player is disposed.
+class PlayerPool {
+ public:
+  static constexpr size_t kDefaultMaxSize = 2;
+
+  PlayerPool() = default;
+  ~PlayerPool();
+
+  PlayerPool(const PlayerPool &) = delete;
+  PlayerPool &operator=(const PlayerPool &) = delete;
+
+  // Disposes the least recently used players above |max_size|. A size of 0
+  // disables preloading.
+  void SetMaxSize(size_t max_size);
+  size_t max_size() const { return max_size_; }
+
+  // Marks the player for |uri| as the most recently used one. Returns false
+  // if there is no such player.
+  bool Touch(const std::string &uri);
+
+  // Adds a player for |uri|, disposing the least recently used player if the
+  // pool is full.
+  void Add(const std::string &uri, std::unique_ptr<VideoPlayer> player);
+
+  // Removes the player for |uri| from the pool and returns it, or nullptr if
+  // there is no usable player for |uri|.
+  std::unique_ptr<VideoPlayer> Take(const std::string &uri);
+
+  // Disposes all players.
+  void Clear();
+
+  PlayerPoolStats GetStats() const;
+
+ private:
+  using Entry = std::pair<std::string, std::unique_ptr<VideoPlayer>>;
+
+  void EvictOldest();
+
+  // The most recently used entries first.
+  std::list<Entry> entries_;
+  size_t max_size_ = kDefaultMaxSize;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+  int64_t evictions_ = 0;
+};
+
+}  // namespace video_player_tizen
+
+#endif  // FLUTTER_PLUGIN_PLAYER_POOL_H_
@@ -0,0 +1,35 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "refresh_interval_estimator.h"
+
+namespace video_player_tizen {
+
+namespace {
+
+// Gaps between draws are only taken as refresh intervals between 240 Hz and
+// 45 Hz. Longer gaps are pauses or multiples of the interval of 50 and 60 Hz
+// displays.
+constexpr auto kMinInterval = std::chrono::microseconds(4167);
+constexpr auto kMaxInterval = std::chrono::microseconds(22222);
+
+}  // namespace
+
+void RefreshIntervalEstimator::OnDraw(Clock::time_point time) {
+  Clock::duration gap = time - last_draw_time_;
+  last_draw_time_ = time;
+  if (gap < kMinInterval || gap > kMaxInterval) {
+    return;
+  }
+  if (gap < interval_ * 3 / 4) {
+    // The display is faster than estimated, so the previous samples were
+    // multiples of the interval.
+    interval_ = gap;
+  } else if (gap < interval_ * 3 / 2) {
+    // Smooth out the jitter of the draw times.
+    interval_ += (gap - interval_) / 8;
+  }
+}
+
+}  // namespace video_player_tizen
@@ -0,0 +1,38 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_REFRESH_INTERVAL_ESTIMATOR_H_
+#define FLUTTER_PLUGIN_REFRESH_INTERVAL_ESTIMATOR_H_
+
+#include <chrono>
+
+namespace video_player_tizen {
+
+// Estimates the refresh interval of the display from the times at which the
+// engine draws the texture, since the plugin cannot query the display.
+//
+// Draws at consecutive refreshes are one interval apart, but the engine only
+// draws when a frame has been requested, so many of the gaps between draws
+// are multiples of the interval. Those are ignored, as are gaps outside the
+// range of common refresh rates. This class is not thread-safe.
+class RefreshIntervalEstimator {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // |initial_interval| is used until the first draws are measured.
+  explicit RefreshIntervalEstimator(Clock::duration initial_interval)
+      : interval_(initial_interval) {}
+
+  void OnDraw(Clock::time_point time);
+
+  Clock::duration interval() const { return interval_; }
+
+ private:
+  Clock::duration interval_;
+  Clock::time_point last_draw_time_;
+};
+
+}  // namespace video_player_tizen
+
+#endif  // FLUTTER_PLUGIN_REFRESH_INTERVAL_ESTIMATOR_H_
@@ -0,0 +1,90 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "texture_ring.h"
+
+namespace video_player_tizen {
+
+TextureRing::TextureRing(size_t slot_count) {
+  if (slot_count < kMinSlotCount) {
+    slot_count = kMinSlotCount;
+  } else if (slot_count > kMaxSlotCount) {
+    slot_count = kMaxSlotCount;
+  }
+  slots_.resize(slot_count);
+}
+
+TextureRing::~TextureRing() { Clear(); }
+
+bool TextureRing::HasFreeSlot() const {
+  for (size_t i = 0; i < slots_.size(); i++) {
+    if (slots_[i].hold_count == 0 && static_cast<int>(i) != current_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void TextureRing::Push(media_packet_h packet) {
+  int index = -1;
+  for (size_t i = 0; i < slots_.size(); i++) {
+    // The current frame may still be on screen, so its slot is not reused.
+    if (slots_[i].hold_count > 0 || static_cast<int>(i) == current_) {
+      continue;
+    }
+    if (index < 0 || slots_[i].last_used < slots_[index].last_used) {
+      index = i;
+    }
+  }
+  if (index < 0) {
+    media_packet_destroy(packet);
+    return;
+  }
+
+  Slot &slot = slots_[index];
+  if (slot.packet) {
+    media_packet_destroy(slot.packet);
+  }
+  slot.packet = packet;
+  slot.last_used = ++use_counter_;
+  current_ = index;
+}
+
+int TextureRing::HoldCurrent() {
+  if (current_ < 0 || !slots_[current_].packet) {
+    return -1;
+  }
+  slots_[current_].hold_count++;
+  return current_;
+}
+
+void TextureRing::Release(size_t index) {
+  if (index < slots_.size() && slots_[index].hold_count > 0) {
+    slots_[index].hold_count--;
+  }
+}
+
+void TextureRing::Invalidate(size_t index) {
+  if (index >= slots_.size() || !slots_[index].packet) {
+    return;
+  }
+  media_packet_destroy(slots_[index].packet);
+  slots_[index].packet = nullptr;
+  if (current_ == static_cast<int>(index)) {
+    current_ = -1;
+  }
+}
+
+void TextureRing::Clear() {
+  for (Slot &slot : slots_) {
+    if (slot.packet) {
+      media_packet_destroy(slot.packet);
+      slot.packet = nullptr;
+    }
+    slot.hold_count = 0;
+  }
+  current_ = -1;
+}
+
+}  // namespace video_player_tizen
@@ -0,0 +1,78 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_TEXTURE_RING_H_
+#define FLUTTER_PLUGIN_TEXTURE_RING_H_
+
+#include <media_packet.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace video_player_tizen {
+
+// A fixed number of slots holding the video frames handed to the engine.
+//
+// A slot is held from the time its frame is obtained by the engine until the
+// engine releases it. A released frame stays in its slot, since the texture
+// may still be sampled from it, until the slot is reused for a newer frame.
+// Free slots are reused in least recently used order. This class is not
+// thread-safe.
+class TextureRing {
+ public:
+  static constexpr size_t kMinSlotCount = 2;
+  static constexpr size_t kMaxSlotCount = 8;
+  static constexpr size_t kDefaultSlotCount = 3;
+
+  explicit TextureRing(size_t slot_count);
+  ~TextureRing();
+
+  TextureRing(const TextureRing &) = delete;
+  TextureRing &operator=(const TextureRing &) = delete;
+
+  size_t slot_count() const { return slots_.size(); }
+
+  bool HasFreeSlot() const;
+
+  // Stores |packet| in a free slot and makes it the current frame. The packet
+  // previously stored in the slot is destroyed. Must only be called if
+  // HasFreeSlot() returns true.
+  void Push(media_packet_h packet);
+
+  // Holds the slot of the current frame and returns its index, or -1 if there
+  // is no current frame.
+  int HoldCurrent();
+
+  // Releases a hold taken by HoldCurrent().
+  void Release(size_t index);
+
+  media_packet_h GetPacket(size_t index) const { return slots_[index].packet; }
+
+  // Destroys the packet of a held slot, e.g. when it cannot be rendered.
+  void Invalidate(size_t index);
+
+  // Destroys all packets.
+  void Clear();
+
+  // Counts the times a frame was due but all slots were held.
+  void RecordFull() { full_count_++; }
+  int64_t full_count() const { return full_count_; }
+
+ private:
+  struct Slot {
+    media_packet_h packet = nullptr;
+    int hold_count = 0;
+    uint64_t last_used = 0;
+  };
+
+  std::vector<Slot> slots_;
+  int current_ = -1;
+  uint64_t use_counter_ = 0;
+  int64_t full_count_ = 0;
+};
+
+}  // namespace video_player_tizen
+
+#endif  // FLUTTER_PLUGIN_TEXTURE_RING_H_
@@ -0,0 +1,304 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "thumbnail_extractor.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <utility>
+
+#include "log.h"
+
+namespace video_player_tizen {
+
+namespace {
+
+constexpr char kFileScheme[] = "file://";
+
+// The frames returned by metadata_extractor_get_frame_at_time() are RGB888.
+constexpr size_t kSourcePixelSize = 3;
+
+int32_t GetIntMetadata(metadata_extractor_h extractor,
+                       metadata_extractor_attr_e attribute) {
+  char *value = nullptr;
+  int ret = metadata_extractor_get_metadata(extractor, attribute, &value);
+  if (ret != METADATA_EXTRACTOR_ERROR_NONE || !value) {
+    return 0;
+  }
+  int32_t result = std::atoi(value);
+  free(value);
+  return result;
+}
+
+// Scales an RGB888 image down to |dst_width| x |dst_height| by averaging the
+// source pixels covered by each destination pixel.
+std::vector<uint8_t> ScaleToRgba(const uint8_t *src, int32_t src_width,
+                                 int32_t src_height, int32_t dst_width,
+                                 int32_t dst_height) {
+  std::vector<uint8_t> dst(static_cast<size_t>(dst_width) * dst_height * 4);
+  uint8_t *out = dst.data();
+  for (int32_t y = 0; y < dst_height; y++) {
+    int32_t y0 = static_cast<int64_t>(y) * src_height / dst_height;
+    int32_t y1 = std::max<int32_t>(
+        y0 + 1, static_cast<int64_t>(y + 1) * src_height / dst_height);
+    for (int32_t x = 0; x < dst_width; x++) {
+      int32_t x0 = static_cast<int64_t>(x) * src_width / dst_width;
+      int32_t x1 = std::max<int32_t>(
+          x0 + 1, static_cast<int64_t>(x + 1) * src_width / dst_width);
+      uint32_t sum[3] = {0, 0, 0};
+      for (int32_t sy = y0; sy < y1; sy++) {
+        const uint8_t *row =
+            src + (static_cast<size_t>(sy) * src_width + x0) * kSourcePixelSize;
+        for (int32_t sx = x0; sx < x1; sx++) {
+          sum[0] += row[0];
+          sum[1] += row[1];
+          sum[2] += row[2];
+          row += kSourcePixelSize;
+        }
+      }
+      uint32_t count = static_cast<uint32_t>((y1 - y0) * (x1 - x0));
+      *out++ = sum[0] / count;
+      *out++ = sum[1] / count;
+      *out++ = sum[2] / count;
+      *out++ = 0xff;
+    }
+  }
+  return dst;
+}
+
+// Rotates an RGBA8888 image of |width| x |height| clockwise by |degrees|,
+// which is one of 90, 180 and 270.
+std::vector<uint8_t> RotateRgba(const std::vector<uint8_t> &src,
+                                int32_t width, int32_t height,
+                                int32_t degrees) {
+  std::vector<uint8_t> dst(src.size());
+  const auto *in = reinterpret_cast<const uint32_t *>(src.data());
+  auto *out = reinterpret_cast<uint32_t *>(dst.data());
+  for (int32_t y = 0; y < height; y++) {
+    for (int32_t x = 0; x < width; x++) {
+      size_t index;
+      if (degrees == 90) {
+        index = static_cast<size_t>(x) * height + (height - 1 - y);
+      } else if (degrees == 180) {
+        index = static_cast<size_t>(height - 1 - y) * width + (width - 1 - x);
+      } else {
+        index = static_cast<size_t>(width - 1 - x) * height + y;
+      }
+      out[index] = in[static_cast<size_t>(y) * width + x];
+    }
+  }
+  return dst;
+}
+
+}  // namespace
+
+ThumbnailExtractor::ThumbnailExtractor(size_t cache_size)
+    : cache_size_(cache_size) {
+  thread_ = std::thread(&ThumbnailExtractor::Run, this);
+}
+
+ThumbnailExtractor::~ThumbnailExtractor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_one();
+  thread_.join();
+}
+
+void ThumbnailExtractor::Extract(const std::string &uri,
+                                 std::vector<int64_t> positions,
+                                 int32_t max_width, bool accurate,
+                                 ResultCallback callback) {
+  std::string path = uri;
+  if (path.compare(0, sizeof(kFileScheme) - 1, kFileScheme) == 0) {
+    path = path.substr(sizeof(kFileScheme) - 1);
+  }
+  if (path.find("://") != std::string::npos) {
+    callback({}, "Thumbnails can only be extracted from local files.");
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.push_back(Request{std::move(path), std::move(positions),
+                                max_width, accurate, std::move(callback)});
+  }
+  condition_.notify_one();
+}
+
+void ThumbnailExtractor::Run() {
+  while (true) {
+    Request request;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stopped_ || !requests_.empty(); });
+      if (stopped_) {
+        break;
+      }
+      request = std::move(requests_.front());
+      requests_.pop_front();
+    }
+    try {
+      Process(request);
+    } catch (const std::exception &exception) {
+      LOG_ERROR("[ThumbnailExtractor] Uncaught exception: %s",
+                exception.what());
+    }
+  }
+
+  // Pending requests are answered so that no reply is left unsent.
+  for (Request &request : requests_) {
+    request.callback({}, "The extractor has been destroyed.");
+  }
+  Close();
+}
+
+void ThumbnailExtractor::Process(Request &request) {
+  std::vector<Thumbnail> thumbnails;
+  thumbnails.reserve(request.positions.size());
+  bool is_open = request.path == path_ && extractor_;
+  for (int64_t position : request.positions) {
+    std::string key = request.path + "@" + std::to_string(position) + "/" +
+                      std::to_string(request.max_width) +
+                      (request.accurate ? "a" : "k");
+    std::optional<Thumbnail> thumbnail = GetCached(key);
+    if (!thumbnail) {
+      // The video is opened only when a frame is not found in the cache.
+      if (!is_open) {
+        if (!Open(request.path)) {
+          request.callback({}, "Failed to open " + request.path + ".");
+          return;
+        }
+        is_open = true;
+      }
+      thumbnail = Decode(position, request.max_width, request.accurate);
+      if (!thumbnail) {
+        continue;
+      }
+      AddToCache(key, *thumbnail);
+    }
+    thumbnails.push_back(std::move(*thumbnail));
+  }
+  request.callback(std::move(thumbnails), std::nullopt);
+}
+
+bool ThumbnailExtractor::Open(const std::string &path) {
+  Close();
+
+  int ret = metadata_extractor_create(&extractor_);
+  if (ret != METADATA_EXTRACTOR_ERROR_NONE) {
+    LOG_ERROR("[ThumbnailExtractor] metadata_extractor_create failed: %s",
+              get_error_message(ret));
+    extractor_ = nullptr;
+    return false;
+  }
+  ret = metadata_extractor_set_path(extractor_, path.c_str());
+  if (ret != METADATA_EXTRACTOR_ERROR_NONE) {
+    LOG_ERROR("[ThumbnailExtractor] metadata_extractor_set_path failed: %s",
+              get_error_message(ret));
+    Close();
+    return false;
+  }
+  video_width_ = GetIntMetadata(extractor_, METADATA_VIDEO_WIDTH);
+  video_height_ = GetIntMetadata(extractor_, METADATA_VIDEO_HEIGHT);
+  if (video_width_ <= 0 || video_height_ <= 0) {
+    LOG_ERROR("[ThumbnailExtractor] No video stream in %s.", path.c_str());
+    Close();
+    return false;
+  }
+  int32_t rotation = GetIntMetadata(extractor_, METADATA_ROTATE);
+  video_rotation_ =
+      rotation == 90 || rotation == 180 || rotation == 270 ? rotation : 0;
+  path_ = path;
+  return true;
+}
+
+void ThumbnailExtractor::Close() {
+  if (extractor_) {
+    metadata_extractor_destroy(extractor_);
+    extractor_ = nullptr;
+  }
+  path_.clear();
+  video_width_ = 0;
+  video_height_ = 0;
+  video_rotation_ = 0;
+}
+
+std::optional<Thumbnail> ThumbnailExtractor::Decode(int64_t position,
+                                                    int32_t max_width,
+                                                    bool accurate) {
+  void *frame = nullptr;
+  int size = 0;
+  int ret = metadata_extractor_get_frame_at_time(
+      extractor_, static_cast<unsigned long>(std::max<int64_t>(position, 0)),
+      accurate, &frame, &size);
+  if (ret != METADATA_EXTRACTOR_ERROR_NONE || !frame) {
+    LOG_ERROR("[ThumbnailExtractor] Failed to get the frame at %lld ms: %s",
+              static_cast<long long>(position), get_error_message(ret));
+    return std::nullopt;
+  }
+  size_t expected_size =
+      static_cast<size_t>(video_width_) * video_height_ * kSourcePixelSize;
+  if (static_cast<size_t>(size) < expected_size) {
+    LOG_ERROR("[ThumbnailExtractor] Unexpected frame size: %d", size);
+    free(frame);
+    return std::nullopt;
+  }
+
+  // The frame is decoded as stored, so |max_width| applies to its height if
+  // it is displayed sideways.
+  bool is_sideways = video_rotation_ == 90 || video_rotation_ == 270;
+  int32_t display_width = is_sideways ? video_height_ : video_width_;
+  int32_t display_height = is_sideways ? video_width_ : video_height_;
+  Thumbnail thumbnail;
+  thumbnail.position = position;
+  thumbnail.width = display_width;
+  thumbnail.height = display_height;
+  if (max_width > 0 && max_width < display_width) {
+    thumbnail.width = max_width;
+    thumbnail.height = std::max<int32_t>(
+        1, static_cast<int64_t>(display_height) * max_width / display_width);
+  }
+  int32_t scaled_width = is_sideways ? thumbnail.height : thumbnail.width;
+  int32_t scaled_height = is_sideways ? thumbnail.width : thumbnail.height;
+  thumbnail.rgba =
+      ScaleToRgba(static_cast<const uint8_t *>(frame), video_width_,
+                  video_height_, scaled_width, scaled_height);
+  free(frame);
+  if (video_rotation_ != 0) {
+    thumbnail.rgba = RotateRgba(thumbnail.rgba, scaled_width, scaled_height,
+                                video_rotation_);
+  }
+  return thumbnail;
+}
+
+std::optional<Thumbnail> ThumbnailExtractor::GetCached(
+    const std::string &key) {
+  auto iter = cache_index_.find(key);
+  if (iter == cache_index_.end()) {
+    return std::nullopt;
+  }
+  cache_.splice(cache_.begin(), cache_, iter->second);
+  return iter->second->second;
+}
+
+void ThumbnailExtractor::AddToCache(const std::string &key,
+                                    const Thumbnail &thumbnail) {
+  size_t bytes = thumbnail.rgba.size();
+  if (bytes > cache_size_) {
+    return;
+  }
+  while (cached_bytes_ + bytes > cache_size_ && !cache_.empty()) {
+    cached_bytes_ -= cache_.back().second.rgba.size();
+    cache_index_.erase(cache_.back().first);
+    cache_.pop_back();
+  }
+  cache_.emplace_front(key, thumbnail);
+  cache_index_[key] = cache_.begin();
+  cached_bytes_ += bytes;
+}
+
+}  // namespace video_player_tizen
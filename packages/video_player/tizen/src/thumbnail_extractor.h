@@ -0,0 +1,106 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_THUMBNAIL_EXTRACTOR_H_
+#define FLUTTER_PLUGIN_THUMBNAIL_EXTRACTOR_H_
+
+#include <metadata_extractor.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace video_player_tizen {
+
+struct Thumbnail {
+  int64_t position = 0;
+  int32_t width = 0;
+  int32_t height = 0;
+  // Pixels in RGBA8888, row by row.
+  std::vector<uint8_t> rgba;
+};
+
+// Decodes video frames at given positions into downscaled RGBA images, e.g.
+// for seek bar previews.
+//
+// Frames are decoded with a metadata extractor of their own on a worker
+// thread, so extraction does not affect the playback of the same video.
+// Decoded frames are kept in a cache of limited size.
+class ThumbnailExtractor {
+ public:
+  // Called with the thumbnails of the positions that could be decoded, or an
+  // error message if the video cannot be opened. May be called on the worker
+  // thread.
+  using ResultCallback =
+      std::function<void(std::vector<Thumbnail> thumbnails,
+                         std::optional<std::string> error)>;
+
+  static constexpr size_t kDefaultCacheSize = 8 * 1024 * 1024;
+
+  explicit ThumbnailExtractor(size_t cache_size = kDefaultCacheSize);
+  ~ThumbnailExtractor();
+
+  ThumbnailExtractor(const ThumbnailExtractor &) = delete;
+  ThumbnailExtractor &operator=(const ThumbnailExtractor &) = delete;
+
+  // Decodes the frames of the local video at |uri| at |positions| (in
+  // milliseconds), rotated as the video is displayed and scaled down to at
+  // most |max_width| pixels wide (0 for no limit). Frames are taken from the
+  // nearest key frames unless |accurate| is true.
+  void Extract(const std::string &uri, std::vector<int64_t> positions,
+               int32_t max_width, bool accurate, ResultCallback callback);
+
+ private:
+  struct Request {
+    std::string path;
+    std::vector<int64_t> positions;
+    int32_t max_width;
+    bool accurate;
+    ResultCallback callback;
+  };
+
+  void Run();
+  void Process(Request &request);
+  bool Open(const std::string &path);
+  void Close();
+  std::optional<Thumbnail> Decode(int64_t position, int32_t max_width,
+                                  bool accurate);
+
+  std::optional<Thumbnail> GetCached(const std::string &key);
+  void AddToCache(const std::string &key, const Thumbnail &thumbnail);
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<Request> requests_;
+  bool stopped_ = false;
+  std::thread thread_;
+
+  // Only accessed on the worker thread.
+  metadata_extractor_h extractor_ = nullptr;
+  std::string path_;
+  int32_t video_width_ = 0;
+  int32_t video_height_ = 0;
+  // The clockwise rotation of the video for display, in degrees.
+  int32_t video_rotation_ = 0;
+
+  using CacheEntry = std::pair<std::string, Thumbnail>;
+  std::list<CacheEntry> cache_;
+  std::unordered_map<std::string, std::list<CacheEntry>::iterator>
+      cache_index_;
+  size_t cache_size_;
+  size_t cached_bytes_ = 0;
+};
+
+}  // namespace video_player_tizen
+
+#endif  // FLUTTER_PLUGIN_THUMBNAIL_EXTRACTOR_H_
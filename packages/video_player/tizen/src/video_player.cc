@@ -47,39 +47,57 @@ static std::string StateToString(player_state_e state) {
 }
 
 void VideoPlayer::ReleaseMediaPacket(void *data) {
-  auto *player = static_cast<VideoPlayer *>(data);
+  auto *slot = static_cast<SurfaceSlot *>(data);
+  VideoPlayer *player = slot->player;
 
   std::lock_guard<std::mutex> lock(player->mutex_);
-  player->is_rendering_ = false;
-  player->OnRenderingCompleted();
+  player->texture_ring_->Release(slot->index);
+  player->RequestRendering();
 }
 
 FlutterDesktopGpuSurfaceDescriptor *VideoPlayer::ObtainGpuSurface(
     size_t width, size_t height) {
   std::lock_guard<std::mutex> lock(mutex_);
-  if (!current_media_packet_) {
+  is_frame_requested_ = false;
+  refresh_interval_estimator_.OnDraw(std::chrono::steady_clock::now());
+  frame_scheduler_.SetVsyncInterval(refresh_interval_estimator_.interval());
+  if (frame_scheduler_.HasFrameToPresent()) {
+    if (texture_ring_->HasFreeSlot()) {
+      media_packet_h packet = frame_scheduler_.PopFrameToPresent();
+      if (packet) {
+        texture_ring_->Push(packet);
+      }
+    } else {
+      // All slots are still held by the engine, the current frame is
+      // presented again and the new one is retried on the next frame.
+      texture_ring_->RecordFull();
+    }
+  }
+  // The remaining frames are requested again when they are due.
+  RequestRendering();
+
+  int index = texture_ring_->HoldCurrent();
+  if (index < 0) {
     LOG_ERROR("[VideoPlayer] current media packet not valid.");
-    is_rendering_ = false;
-    OnRenderingCompleted();
     return nullptr;
   }
 
   tbm_surface_h surface;
-  int ret = media_packet_get_tbm_surface(current_media_packet_, &surface);
+  int ret =
+      media_packet_get_tbm_surface(texture_ring_->GetPacket(index), &surface);
   if (ret != MEDIA_PACKET_ERROR_NONE || !surface) {
     LOG_ERROR("[VideoPlayer] Failed to get a tbm surface, error: %d", ret);
-    is_rendering_ = false;
-    media_packet_destroy(current_media_packet_);
-    current_media_packet_ = nullptr;
-    OnRenderingCompleted();
+    texture_ring_->Release(index);
+    texture_ring_->Invalidate(index);
     return nullptr;
   }
-  gpu_surface_->handle = surface;
-  gpu_surface_->width = width;
-  gpu_surface_->height = height;
-  gpu_surface_->release_context = this;
-  gpu_surface_->release_callback = ReleaseMediaPacket;
-  return gpu_surface_.get();
+  SurfaceSlot &slot = surface_slots_[index];
+  slot.descriptor.handle = surface;
+  slot.descriptor.width = width;
+  slot.descriptor.height = height;
+  slot.descriptor.release_context = &slot;
+  slot.descriptor.release_callback = ReleaseMediaPacket;
+  return &slot.descriptor;
 }
 
 #ifdef TV_PROFILE
@@ -124,6 +142,12 @@ VideoPlayer::VideoPlayer(flutter::PluginRegistrar *plugin_registrar,
         self->SendPendingEvents();
       },
       this);
+  render_timer_pipe_ = ecore_pipe_add(
+      [](void *data, void *buffer, unsigned int nbyte) -> void {
+        auto *self = static_cast<VideoPlayer *>(data);
+        self->ArmRenderTimer();
+      },
+      this);
 
   texture_registrar_ = texture_registrar;
 
@@ -134,7 +158,13 @@ VideoPlayer::VideoPlayer(flutter::PluginRegistrar *plugin_registrar,
                  size_t height) -> const FlutterDesktopGpuSurfaceDescriptor * {
             return this->ObtainGpuSurface(width, height);
           }));
-  gpu_surface_ = std::make_unique<FlutterDesktopGpuSurfaceDescriptor>();
+  texture_ring_ =
+      std::make_unique<TextureRing>(options.GetTextureSlotCount());
+  surface_slots_.resize(texture_ring_->slot_count());
+  for (size_t i = 0; i < surface_slots_.size(); i++) {
+    surface_slots_[i].player = this;
+    surface_slots_[i].index = i;
+  }
   texture_id_ = texture_registrar->RegisterTexture(texture_variant_.get());
 
   media_player_proxy_ = std::make_unique<MediaPlayerProxy>();
@@ -305,6 +335,10 @@ void VideoPlayer::Play() {
   if (ret != PLAYER_ERROR_NONE) {
     throw VideoPlayerError("player_start failed", get_error_message(ret));
   }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame_scheduler_.ResetClock();
+  }
 #ifdef TV_PROFILE
   timer_ = ecore_timer_add(30, ResetScreensaverTimeout, this);
 #endif
@@ -366,11 +400,20 @@ void VideoPlayer::SetPlaybackSpeed(double speed) {
     throw VideoPlayerError("player_set_playback_rate failed",
                            get_error_message(ret));
   }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  frame_scheduler_.SetPlaybackRate(speed);
 }
 
 void VideoPlayer::SeekTo(int32_t position, SeekCompletedCallback callback) {
   LOG_DEBUG("[VideoPlayer] position: %d", position);
 
+  {
+    // Frames queued before the seek are not shown.
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame_scheduler_.Flush();
+  }
+
   on_seek_completed_ = std::move(callback);
   int ret =
       player_set_play_position(player_, position, true, OnSeekCompleted, this);
@@ -398,6 +441,33 @@ int32_t VideoPlayer::GetPosition() {
   return position;
 }
 
+FrameStats VideoPlayer::GetFrameStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  FrameStats stats = frame_scheduler_.GetStats();
+  stats.ring_full = texture_ring_->full_count();
+  return stats;
+}
+
+void VideoPlayer::SetProgressInterval(int32_t interval_ms) {
+  LOG_DEBUG("[VideoPlayer] progress interval: %d ms", interval_ms);
+
+  if (progress_timer_) {
+    ecore_timer_del(progress_timer_);
+    progress_timer_ = nullptr;
+  }
+  if (interval_ms <= 0) {
+    return;
+  }
+  // Make sure that the first tick sends an event.
+  last_progress_position_ = -1;
+  progress_timer_ =
+      ecore_timer_add(interval_ms / 1000.0, OnProgressTimer, this);
+  if (!progress_timer_) {
+    throw VideoPlayerError("ecore_timer_add failed",
+                           "Failed to create the progress timer.");
+  }
+}
+
 void VideoPlayer::Dispose() {
   LOG_DEBUG("[VideoPlayer] Player disposing.");
 
@@ -408,23 +478,28 @@ void VideoPlayer::Dispose() {
     ecore_pipe_del(sink_event_pipe_);
   }
 
+  if (render_timer_pipe_) {
+    ecore_pipe_del(render_timer_pipe_);
+    render_timer_pipe_ = nullptr;
+  }
+
+  if (render_timer_) {
+    ecore_timer_del(render_timer_);
+    render_timer_ = nullptr;
+  }
+
   event_sink_ = nullptr;
   event_channel_->SetStreamHandler(nullptr);
 
-  while (!packet_queue_.empty()) {
-    media_packet_destroy(packet_queue_.front());
-    packet_queue_.pop();
-  }
+  frame_scheduler_.Flush();
 
-  if (current_media_packet_) {
-    media_packet_destroy(current_media_packet_);
-    current_media_packet_ = nullptr;
-  }
+  texture_ring_->Clear();
 
-  if (previous_media_packet_) {
-    media_packet_destroy(previous_media_packet_);
-    previous_media_packet_ = nullptr;
+  if (progress_timer_) {
+    ecore_timer_del(progress_timer_);
+    progress_timer_ = nullptr;
   }
+
   if (texture_registrar_) {
     texture_registrar_->UnregisterTexture(texture_id_, nullptr);
     texture_registrar_ = nullptr;
@@ -543,6 +618,69 @@ void VideoPlayer::SendIsPlayingStateUpdate(bool is_playing) {
   PushEvent(flutter::EncodableValue(result));
 }
 
+void VideoPlayer::SendProgress() {
+  if (!event_sink_ || !is_initialized_) {
+    return;
+  }
+
+  int position = 0;
+  if (player_get_play_position(player_, &position) != PLAYER_ERROR_NONE) {
+    return;
+  }
+  player_state_e state = PLAYER_STATE_NONE;
+  player_get_state(player_, &state);
+  bool is_playing = state == PLAYER_STATE_PLAYING;
+  // Only available for streaming content, in percent of the duration.
+  int buffered_start = 0, buffered_end = 0;
+  if (player_get_streaming_download_progress(
+          player_, &buffered_start, &buffered_end) != PLAYER_ERROR_NONE) {
+    buffered_start = buffered_end = -1;
+  }
+
+  // Nothing to update while paused or stalled.
+  if (position == last_progress_position_ &&
+      is_playing == last_progress_is_playing_ &&
+      buffered_start == last_progress_buffered_start_ &&
+      buffered_end == last_progress_buffered_end_) {
+    return;
+  }
+  last_progress_position_ = position;
+  last_progress_is_playing_ = is_playing;
+  last_progress_buffered_start_ = buffered_start;
+  last_progress_buffered_end_ = buffered_end;
+
+  flutter::EncodableList buffered;
+  if (buffered_end > buffered_start) {
+    int64_t duration = GetDuration();
+    buffered.push_back(flutter::EncodableValue(flutter::EncodableList{
+        flutter::EncodableValue(duration * buffered_start / 100),
+        flutter::EncodableValue(duration * buffered_end / 100),
+    }));
+  }
+  flutter::EncodableMap result = {
+      {flutter::EncodableValue("event"), flutter::EncodableValue("progress")},
+      {flutter::EncodableValue("position"), flutter::EncodableValue(position)},
+      {flutter::EncodableValue("values"), flutter::EncodableValue(buffered)},
+      {flutter::EncodableValue("isPlaying"),
+       flutter::EncodableValue(is_playing)},
+  };
+  PushEvent(flutter::EncodableValue(result));
+}
+
+Eina_Bool VideoPlayer::OnProgressTimer(void *data) {
+  auto *player = static_cast<VideoPlayer *>(data);
+  player->SendProgress();
+  return ECORE_CALLBACK_RENEW;
+}
+
+Eina_Bool VideoPlayer::OnRenderTimer(void *data) {
+  auto *player = static_cast<VideoPlayer *>(data);
+  std::lock_guard<std::mutex> lock(player->mutex_);
+  player->render_timer_ = nullptr;
+  player->RequestRendering();
+  return ECORE_CALLBACK_CANCEL;
+}
+
 #ifdef TV_PROFILE
 Eina_Bool VideoPlayer::ResetScreensaverTimeout(void *data) {
   LOG_DEBUG("[VideoPlayer] Reset screen saver timeout.");
@@ -605,6 +743,7 @@ void VideoPlayer::OnInterrupted(player_interrupted_code_e code, void *data) {
   LOG_ERROR("[VideoPlayer] Interrupt code: %d", code);
 
   auto *player = static_cast<VideoPlayer *>(data);
+  player->has_error_ = true;
   player->SendError("Interrupted error", "Video player has been interrupted.");
 }
 
@@ -613,6 +752,7 @@ void VideoPlayer::OnError(int error_code, void *data) {
             get_error_message(error_code));
 
   auto *player = static_cast<VideoPlayer *>(data);
+  player->has_error_ = true;
   player->SendError("Player error",
                     std::string("Error: ") + get_error_message(error_code));
 }
@@ -625,32 +765,44 @@ void VideoPlayer::OnVideoFrameDecoded(media_packet_h packet, void *data) {
     media_packet_destroy(packet);
     return;
   }
-  player->packet_queue_.push(packet);
+  player->frame_scheduler_.PushFrame(packet);
   player->RequestRendering();
 }
 
 void VideoPlayer::RequestRendering() {
-  if (packet_queue_.empty() || is_rendering_) {
+  if (!frame_scheduler_.HasFrames() || is_frame_requested_) {
     return;
   }
-  if (texture_registrar_->MarkTextureFrameAvailable(texture_id_)) {
-    is_rendering_ = true;
-    previous_media_packet_ = current_media_packet_;
-    current_media_packet_ = packet_queue_.front();
-    packet_queue_.pop();
-    while (!packet_queue_.empty()) {
-      media_packet_destroy(packet_queue_.front());
-      packet_queue_.pop();
+  // Frames decoded ahead of time are requested when they are due, rather
+  // than having the engine draw the same frame again at every vsync.
+  if (frame_scheduler_.GetRenderRequestDelay() >
+      FrameScheduler::Clock::duration::zero()) {
+    if (render_timer_pipe_) {
+      ecore_pipe_write(render_timer_pipe_, nullptr, 0);
     }
+    return;
+  }
+  // The frame to show is picked in ObtainGpuSurface, when the engine draws
+  // the next frame.
+  if (texture_registrar_->MarkTextureFrameAvailable(texture_id_)) {
+    is_frame_requested_ = true;
   }
 }
 
-void VideoPlayer::OnRenderingCompleted() {
-  if (previous_media_packet_) {
-    media_packet_destroy(previous_media_packet_);
-    previous_media_packet_ = nullptr;
+void VideoPlayer::ArmRenderTimer() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (render_timer_) {
+    ecore_timer_del(render_timer_);
+    render_timer_ = nullptr;
   }
-  RequestRendering();
+  if (!is_initialized_ || !frame_scheduler_.HasFrames()) {
+    return;
+  }
+  // Re-armed on every request, since the oldest frame may have changed.
+  double delay = std::chrono::duration<double>(
+                     frame_scheduler_.GetRenderRequestDelay())
+                     .count();
+  render_timer_ = ecore_timer_add(delay, OnRenderTimer, this);
 }
 
 int64_t VideoPlayer::GetDuration() {
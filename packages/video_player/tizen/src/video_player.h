@@ -12,13 +12,18 @@
 #include <flutter/texture_registrar.h>
 #include <player.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <vector>
 
+#include "frame_scheduler.h"
 #include "media_player_proxy.h"
+#include "refresh_interval_estimator.h"
+#include "texture_ring.h"
 #include "video_player_options.h"
 
 namespace video_player_tizen {
@@ -43,9 +48,15 @@ class VideoPlayer {
   void SetPlaybackSpeed(double speed);
   void SeekTo(int32_t position, SeekCompletedCallback callback);
   int32_t GetPosition();
+  FrameStats GetFrameStats();
+  // Sends the position, buffered range and playing state in a single
+  // "progress" event every |interval_ms|, or stops sending if 0.
+  void SetProgressInterval(int32_t interval_ms);
   void Dispose();
 
   int64_t GetTextureId() { return texture_id_; }
+  const std::string &uri() const { return uri_; }
+  bool HasError() const { return has_error_; }
 
  private:
   void SendPendingEvents();
@@ -59,6 +70,7 @@ class VideoPlayer {
   void Initialize();
   void SendInitialized();
   void SendIsPlayingStateUpdate(bool is_playing);
+  void SendProgress();
 #ifdef TV_PROFILE
   void InitScreenSaverApi();
 #endif
@@ -71,21 +83,29 @@ class VideoPlayer {
   static void OnError(int error_code, void *data);
   static void OnVideoFrameDecoded(media_packet_h packet, void *data);
   static void ReleaseMediaPacket(void *packet);
+  static Eina_Bool OnProgressTimer(void *data);
+  static Eina_Bool OnRenderTimer(void *data);
 #ifdef TV_PROFILE
   static Eina_Bool ResetScreensaverTimeout(void *data);
 #endif
 
   void RequestRendering();
-  void OnRenderingCompleted();
+  void ArmRenderTimer();
   int64_t GetDuration();
   int64_t GetLiveDuration();
   bool IsLive();
 
-  media_packet_h current_media_packet_ = nullptr;
-  media_packet_h previous_media_packet_ = nullptr;
+  // The surface handed to the engine for a slot of the texture ring.
+  struct SurfaceSlot {
+    VideoPlayer *player;
+    size_t index;
+    FlutterDesktopGpuSurfaceDescriptor descriptor;
+  };
 
   bool is_initialized_ = false;
-  bool is_rendering_ = false;
+  bool is_frame_requested_ = false;
+  // Set on player callback threads and read by the pool.
+  std::atomic<bool> has_error_ = false;
   bool is_live_ = false;
 
   std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>>
@@ -99,9 +119,12 @@ class VideoPlayer {
 
   flutter::TextureRegistrar *texture_registrar_;
   std::unique_ptr<flutter::TextureVariant> texture_variant_;
-  std::unique_ptr<FlutterDesktopGpuSurfaceDescriptor> gpu_surface_;
   std::mutex mutex_;
-  std::queue<media_packet_h> packet_queue_;
+  FrameScheduler frame_scheduler_;
+  RefreshIntervalEstimator refresh_interval_estimator_{
+      FrameScheduler::kDefaultVsyncInterval};
+  std::unique_ptr<TextureRing> texture_ring_;
+  std::vector<SurfaceSlot> surface_slots_;
 
   SeekCompletedCallback on_seek_completed_;
 
@@ -111,7 +134,16 @@ class VideoPlayer {
   Ecore_Timer *timer_ = nullptr;
 #endif
 
+  Ecore_Timer *progress_timer_ = nullptr;
+  int32_t last_progress_position_ = -1;
+  int last_progress_buffered_start_ = -1;
+  int last_progress_buffered_end_ = -1;
+  bool last_progress_is_playing_ = false;
+
   Ecore_Pipe *sink_event_pipe_ = nullptr;
+  // Arms |render_timer_| on the main thread for frames that are not due yet.
+  Ecore_Pipe *render_timer_pipe_ = nullptr;
+  Ecore_Timer *render_timer_ = nullptr;
   std::mutex queue_mutex_;
   std::queue<flutter::EncodableValue> encodable_event_queue_;
   std::queue<std::pair<std::string, std::string>> error_event_queue_;
@@ -5,6 +5,10 @@
 #ifndef FLUTTER_PLUGIN_VIDEO_PLAYER_OPTIONS_H_
 #define FLUTTER_PLUGIN_VIDEO_PLAYER_OPTIONS_H_
 
+#include <cstddef>
+
+#include "texture_ring.h"
+
 class VideoPlayerOptions {
  public:
   VideoPlayerOptions() {}
@@ -18,8 +22,15 @@ class VideoPlayerOptions {
   }
   bool GetMixWithOthers() const { return mix_with_others_; }
 
+  void SetTextureSlotCount(size_t texture_slot_count) {
+    texture_slot_count_ = texture_slot_count;
+  }
+  size_t GetTextureSlotCount() const { return texture_slot_count_; }
+
  private:
   bool mix_with_others_ = true;
+  size_t texture_slot_count_ =
+      video_player_tizen::TextureRing::kDefaultSlotCount;
 };
 
 #endif  // FLUTTER_PLUGIN_VIDEO_PLAYER_OPTIONS_H_
@@ -4,23 +4,44 @@
 
 #include "video_player_tizen_plugin.h"
 
+#include <Ecore.h>
 #include <app_common.h>
 #include <flutter/encodable_value.h>
 #include <flutter/plugin_registrar.h>
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "log.h"
 #include "messages.h"
+#include "player_pool.h"
+#include "thumbnail_extractor.h"
 #include "video_player.h"
 #include "video_player_error.h"
 #include "video_player_options.h"
 
 namespace video_player_tizen {
 
+namespace {
+
+// Runs |callback| on the platform thread. Can be called from any thread.
+void RunOnPlatformThread(std::function<void()> callback) {
+  ecore_main_loop_thread_safe_call_async(
+      [](void *data) {
+        auto *callback = static_cast<std::function<void()> *>(data);
+        (*callback)();
+        delete callback;
+      },
+      new std::function<void()>(std::move(callback)));
+}
+
+}  // namespace
+
 class VideoPlayerTizenPlugin : public flutter::Plugin,
                                public TizenVideoPlayerApi {
  public:
@@ -44,14 +65,32 @@ class VideoPlayerTizenPlugin : public flutter::Plugin,
   std::optional<FlutterError> Pause(const TextureMessage &msg) override;
   std::optional<FlutterError> SetMixWithOthers(
       const MixWithOthersMessage &msg) override;
+  ErrorOr<FrameStatsMessage> FrameStats(const TextureMessage &msg) override;
+  std::optional<FlutterError> SetTextureSlotCount(
+      const TextureSlotCountMessage &msg) override;
+  std::optional<FlutterError> Preload(const CreateMessage &msg) override;
+  std::optional<FlutterError> SetPreloadPoolSize(
+      const PreloadPoolSizeMessage &msg) override;
+  ErrorOr<PreloadStatsMessage> PreloadStats() override;
+  std::optional<FlutterError> SetProgressInterval(
+      const ProgressIntervalMessage &msg) override;
+  void Thumbnails(
+      const ThumbnailRequestMessage &msg,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
 
  private:
   void DisposeAllPlayers();
+  std::optional<FlutterError> GetDataSource(
+      const CreateMessage &msg, std::string &uri,
+      flutter::EncodableMap &http_headers);
 
   flutter::PluginRegistrar *plugin_registrar_;
   flutter::TextureRegistrar *texture_registrar_;
   VideoPlayerOptions options_;
   std::map<int64_t, std::unique_ptr<VideoPlayer>> players_;
+  PlayerPool player_pool_;
+  ThumbnailExtractor thumbnail_extractor_;
 };
 
 void VideoPlayerTizenPlugin::RegisterWithRegistrar(
@@ -75,18 +114,12 @@ void VideoPlayerTizenPlugin::DisposeAllPlayers() {
     player->Dispose();
   }
   players_.clear();
+  player_pool_.Clear();
 }
 
-std::optional<FlutterError> VideoPlayerTizenPlugin::Initialize() {
-  DisposeAllPlayers();
-  return std::nullopt;
-}
-
-ErrorOr<TextureMessage> VideoPlayerTizenPlugin::Create(
-    const CreateMessage &msg) {
-  std::string uri;
-  flutter::EncodableMap http_headers = {};
-
+std::optional<FlutterError> VideoPlayerTizenPlugin::GetDataSource(
+    const CreateMessage &msg, std::string &uri,
+    flutter::EncodableMap &http_headers) {
   if (msg.asset() && !msg.asset()->empty()) {
     char *res_path = app_get_resource_path();
     if (res_path) {
@@ -105,8 +138,31 @@ ErrorOr<TextureMessage> VideoPlayerTizenPlugin::Create(
   } else {
     return FlutterError("Invalid argument", "Either asset or uri must be set.");
   }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> VideoPlayerTizenPlugin::Initialize() {
+  DisposeAllPlayers();
+  return std::nullopt;
+}
+
+ErrorOr<TextureMessage> VideoPlayerTizenPlugin::Create(
+    const CreateMessage &msg) {
+  std::string uri;
+  flutter::EncodableMap http_headers = {};
+  std::optional<FlutterError> error = GetDataSource(msg, uri, http_headers);
+  if (error) {
+    return *error;
+  }
   LOG_DEBUG("[VideoPlayerTizenPlugin] uri: %s", uri.c_str());
 
+  std::unique_ptr<VideoPlayer> preloaded_player = player_pool_.Take(uri);
+  if (preloaded_player) {
+    int64_t texture_id = preloaded_player->GetTextureId();
+    players_[texture_id] = std::move(preloaded_player);
+    return TextureMessage(texture_id);
+  }
+
   int64_t texture_id = 0;
   try {
     auto player = std::make_unique<VideoPlayer>(
@@ -246,6 +302,128 @@ std::optional<FlutterError> VideoPlayerTizenPlugin::SetMixWithOthers(
   return std::nullopt;
 }
 
+ErrorOr<FrameStatsMessage> VideoPlayerTizenPlugin::FrameStats(
+    const TextureMessage &msg) {
+  auto iter = players_.find(msg.texture_id());
+  if (iter == players_.end()) {
+    return FlutterError("Invalid argument", "Player not found.");
+  }
+
+  video_player_tizen::FrameStats stats = iter->second->GetFrameStats();
+  FrameStatsMessage result(msg.texture_id(), stats.decoded, stats.presented,
+                           stats.dropped_late, stats.dropped_overflow,
+                           stats.average_render_latency_us, stats.ring_full);
+  return result;
+}
+
+std::optional<FlutterError> VideoPlayerTizenPlugin::SetTextureSlotCount(
+    const TextureSlotCountMessage &msg) {
+  int64_t slot_count = msg.slot_count();
+  if (slot_count < static_cast<int64_t>(TextureRing::kMinSlotCount) ||
+      slot_count > static_cast<int64_t>(TextureRing::kMaxSlotCount)) {
+    return FlutterError("Invalid argument",
+                        "The slot count must be between 2 and 8.");
+  }
+  options_.SetTextureSlotCount(slot_count);
+  return std::nullopt;
+}
+
+std::optional<FlutterError> VideoPlayerTizenPlugin::Preload(
+    const CreateMessage &msg) {
+  std::string uri;
+  flutter::EncodableMap http_headers = {};
+  std::optional<FlutterError> error = GetDataSource(msg, uri, http_headers);
+  if (error) {
+    return error;
+  }
+  if (player_pool_.max_size() == 0 || player_pool_.Touch(uri)) {
+    return std::nullopt;
+  }
+  LOG_DEBUG("[VideoPlayerTizenPlugin] preload uri: %s", uri.c_str());
+
+  try {
+    auto player = std::make_unique<VideoPlayer>(
+        plugin_registrar_, texture_registrar_, uri, options_, http_headers);
+    player_pool_.Add(uri, std::move(player));
+  } catch (const VideoPlayerError &error) {
+    return FlutterError(error.code(), error.message());
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> VideoPlayerTizenPlugin::SetPreloadPoolSize(
+    const PreloadPoolSizeMessage &msg) {
+  if (msg.max_size() < 0) {
+    return FlutterError("Invalid argument",
+                        "The pool size must not be negative.");
+  }
+  player_pool_.SetMaxSize(msg.max_size());
+  return std::nullopt;
+}
+
+ErrorOr<PreloadStatsMessage> VideoPlayerTizenPlugin::PreloadStats() {
+  PlayerPoolStats stats = player_pool_.GetStats();
+  PreloadStatsMessage result(stats.size, stats.max_size, stats.hits,
+                             stats.misses, stats.evictions);
+  return result;
+}
+
+std::optional<FlutterError> VideoPlayerTizenPlugin::SetProgressInterval(
+    const ProgressIntervalMessage &msg) {
+  if (msg.interval_ms() < 0) {
+    return FlutterError("Invalid argument",
+                        "The interval must not be negative.");
+  }
+  auto iter = players_.find(msg.texture_id());
+  if (iter == players_.end()) {
+    return FlutterError("Invalid argument", "Player not found.");
+  }
+
+  try {
+    iter->second->SetProgressInterval(msg.interval_ms());
+  } catch (const VideoPlayerError &error) {
+    return FlutterError(error.code(), error.message());
+  }
+  return std::nullopt;
+}
+
+void VideoPlayerTizenPlugin::Thumbnails(
+    const ThumbnailRequestMessage &msg,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  auto iter = players_.find(msg.texture_id());
+  if (iter == players_.end()) {
+    result(FlutterError("Invalid argument", "Player not found."));
+    return;
+  }
+
+  std::vector<int64_t> positions;
+  positions.reserve(msg.positions().size());
+  for (const flutter::EncodableValue &position : msg.positions()) {
+    positions.push_back(position.LongValue());
+  }
+  thumbnail_extractor_.Extract(
+      iter->second->uri(), std::move(positions), msg.max_width(),
+      msg.accurate(),
+      [result](std::vector<Thumbnail> thumbnails,
+               std::optional<std::string> error) {
+        RunOnPlatformThread([result, thumbnails = std::move(thumbnails),
+                             error = std::move(error)]() {
+          if (error) {
+            result(FlutterError("Thumbnail error", *error));
+            return;
+          }
+          flutter::EncodableList list;
+          list.reserve(thumbnails.size());
+          for (const Thumbnail &thumbnail : thumbnails) {
+            list.push_back(flutter::CustomEncodableValue(
+                ThumbnailMessage(thumbnail.position, thumbnail.width,
+                                 thumbnail.height, thumbnail.rgba)));
+          }
+          result(std::move(list));
+        });
+      });
+}
+
 }  // namespace video_player_tizen
 
 void VideoPlayerTizenPluginRegisterWithRegistrar(
@@ -273,28 +273,32 @@ class SubtitleAttribute {
   final Object attrValue;
 
   /// Parse a subtitle attribute list from the subtitle attribute list which given by eventListener.
+  ///
+  /// The list is flat, with four elements per attribute: the type, the start
+  /// time, the stop time and the value.
   static List<SubtitleAttribute> fromEventSubtitleAttrList(
     List<dynamic>? eventSubtitleAttrList,
   ) {
     final List<SubtitleAttribute> subtitleAttributes = <SubtitleAttribute>[];
-    final List<Map<Object?, Object?>?> subtitleAttrList =
-        eventSubtitleAttrList!.cast<Map<Object?, Object?>?>();
+    final List<Object?> subtitleAttrList =
+        eventSubtitleAttrList?.cast<Object?>() ?? <Object?>[];
 
-    for (final Map<Object?, Object?>? attr in subtitleAttrList) {
-      final int attrTypeNum = attr!['attrType']! as int;
-      final int startTime = attr['startTime']! as int;
-      final int stopTime = attr['stopTime']! as int;
+    for (int i = 0; i + 3 < subtitleAttrList.length; i += 4) {
+      final int attrTypeNum = subtitleAttrList[i]! as int;
+      final int startTime = subtitleAttrList[i + 1]! as int;
+      final int stopTime = subtitleAttrList[i + 2]! as int;
+      final Object? value = subtitleAttrList[i + 3];
 
       Object attrValue;
       if (SubtitleAttrType.getValueType(attrTypeNum) ==
           SubtitleAttrValueType.double) {
-        attrValue = attr['attrValue']! as double;
+        attrValue = value! as double;
       } else if (SubtitleAttrType.getValueType(attrTypeNum) ==
           SubtitleAttrValueType.int) {
-        attrValue = attr['attrValue']! as int;
+        attrValue = value! as int;
       } else if (SubtitleAttrType.getValueType(attrTypeNum) ==
           SubtitleAttrValueType.string) {
-        attrValue = attr['attrValue']! as String;
+        attrValue = value! as String;
       } else {
         attrValue = 'failed';
       }
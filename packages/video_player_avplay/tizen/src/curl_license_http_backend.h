@@ -0,0 +1,22 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_CURL_LICENSE_HTTP_BACKEND_H_
+#define FLUTTER_PLUGIN_CURL_LICENSE_HTTP_BACKEND_H_
+
+#include "license_http_backend.h"
+
+// Sends license requests with curl.
+//
+// Connections, DNS entries and TLS sessions are kept between requests and
+// shared by all instances, so that a later request to the same license
+// server, e.g. on a key rotation or a channel change, can skip the TCP and
+// TLS handshakes.
+class CurlLicenseHttpBackend : public LicenseHttpBackend {
+ public:
+  DRM_RESULT Send(const LicenseHttpRequest& request,
+                  LicenseHttpResponse& response) override;
+};
+
+#endif  // FLUTTER_PLUGIN_CURL_LICENSE_HTTP_BACKEND_H_
@@ -21,6 +21,12 @@ static std::string GetDrmSubType(int drm_type) {
   }
 }
 
+static long long ElapsedMs(std::chrono::steady_clock::time_point from,
+                           std::chrono::steady_clock::time_point to) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(to - from)
+      .count();
+}
+
 DrmManager::DrmManager() : drm_type_(DM_TYPE_NONE) {
   license_request_pipe_ = ecore_pipe_add(
       [](void *data, void *buffer, unsigned int nbyte) -> void {
@@ -82,11 +88,18 @@ bool DrmManager::SetChallenge(const std::string &media_url,
 
 bool DrmManager::SetChallenge(const std::string &media_url,
                               const std::string &license_server_url) {
-  license_server_url_ = license_server_url;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    license_server_url_ = license_server_url;
+  }
+  StartLicenseWorker();
   return DM_ERROR_NONE == SetChallenge(media_url);
 }
 
 void DrmManager::ReleaseDrmSession() {
+  // Abort an ongoing license transaction, its result cannot be installed.
+  StopLicenseWorker();
+
   if (drm_session_ == nullptr) {
     LOG_ERROR("[DrmManager] Already released.");
     return;
@@ -228,40 +241,45 @@ void DrmManager::OnDrmManagerError(long error_code, char *error_message,
             error_message);
 }
 
-bool DrmManager::ProcessLicense(DataForLicenseProcess &data) {
-  LOG_INFO("[DrmManager] Start process license.");
-
-  if (!license_server_url_.empty()) {
-    // Get license via the license server.
-    unsigned char *response_data = nullptr;
-    unsigned long response_len = 0;
-    DRM_RESULT ret = DrmLicenseHelper::DoTransactionTZ(
-        license_server_url_.c_str(), data.message.c_str(), data.message.size(),
-        &response_data, &response_len,
-        static_cast<DrmLicenseHelper::DrmType>(drm_type_), nullptr, nullptr);
-    if (DRM_SUCCESS != ret || nullptr == response_data || 0 == response_len) {
-      LOG_ERROR("[DrmManager] Fail to get respone by license server url.");
-      return false;
-    }
-    LOG_INFO("[DrmManager] Response length : %lu", response_len);
-    InstallKey(const_cast<void *>(
-                   reinterpret_cast<const void *>(data.session_id.c_str())),
-               static_cast<void *>(response_data),
-               reinterpret_cast<void *>(response_len));
+bool DrmManager::FetchLicense(const DataForLicenseProcess &data,
+                              const std::string &license_server_url,
+                              LicenseResponse &response) {
+  LOG_INFO("[DrmManager] Start fetch license.");
+
+  response.session_id = data.session_id;
+  response.requested_at = data.requested_at;
+  response.sent_at = Clock::now();
+  unsigned char *response_data = nullptr;
+  unsigned long response_len = 0;
+  DRM_RESULT ret = DrmLicenseHelper::DoTransactionTZ(
+      license_server_url.c_str(), data.message.c_str(), data.message.size(),
+      &response_data, &response_len,
+      static_cast<DrmLicenseHelper::DrmType>(drm_type_), nullptr,
+      &license_http_context_);
+  response.received_at = Clock::now();
+  if (DRM_SUCCESS != ret || nullptr == response_data || 0 == response_len) {
+    LOG_ERROR(
+        "[DrmManager] Fail to get respone by license server url after %lld "
+        "ms, drm_result: 0x%lx",
+        ElapsedMs(response.sent_at, response.received_at), ret);
     free(response_data);
-  } else if (request_license_channel_) {
-    // Get license via the Dart callback.
-    RequestLicense(data.session_id, data.message);
-  } else {
-    LOG_ERROR("[DrmManager] No way to request license.");
+    return false;
   }
-  return false;
+  LOG_INFO("[DrmManager] Response length : %lu", response_len);
+  response.data.assign(response_data, response_data + response_len);
+  free(response_data);
+  return true;
 }
 
 void DrmManager::InstallKey(void *session_id, void *response_data,
                             void *response_len) {
   LOG_INFO("[DrmManager] Start install license.");
 
+  if (!drm_session_) {
+    LOG_ERROR("[DrmManager] Invalid drm session.");
+    return;
+  }
+
   SetDataParam_t license_param = {};
   license_param.param1 = session_id;
   license_param.param2 = response_data;
@@ -274,15 +292,34 @@ void DrmManager::InstallKey(void *session_id, void *response_data,
   }
 }
 
-void DrmManager::RequestLicense(std::string &session_id, std::string &message) {
+void DrmManager::InstallLicense(LicenseResponse &response) {
+  Clock::time_point install_start = Clock::now();
+  InstallKey(const_cast<void *>(
+                 reinterpret_cast<const void *>(response.session_id.c_str())),
+             static_cast<void *>(response.data.data()),
+             reinterpret_cast<void *>(response.data.size()));
+  Clock::time_point install_end = Clock::now();
+  LOG_INFO(
+      "[DrmManager] License acquired in %lld ms (queued: %lld ms, "
+      "transaction: %lld ms, dispatch: %lld ms, install: %lld ms).",
+      ElapsedMs(response.requested_at, install_end),
+      ElapsedMs(response.requested_at, response.sent_at),
+      ElapsedMs(response.sent_at, response.received_at),
+      ElapsedMs(response.received_at, install_start),
+      ElapsedMs(install_start, install_end));
+}
+
+void DrmManager::RequestLicense(const DataForLicenseProcess &data) {
   LOG_INFO("[DrmManager] Start request license.");
 
   if (request_license_channel_ == nullptr) {
-    LOG_ERROR("[DrmManager] request license channel is null.");
+    LOG_ERROR("[DrmManager] No way to request license.");
     return;
   }
 
-  std::vector<uint8_t> message_vec(message.begin(), message.end());
+  std::string session_id = data.session_id;
+  Clock::time_point requested_at = data.requested_at;
+  std::vector<uint8_t> message_vec(data.message.begin(), data.message.end());
   flutter::EncodableMap args_map = {
       {flutter::EncodableValue("message"),
        flutter::EncodableValue(message_vec)},
@@ -290,7 +327,8 @@ void DrmManager::RequestLicense(std::string &session_id, std::string &message) {
   auto result_handler =
       std::make_unique<flutter::MethodResultFunctions<flutter::EncodableValue>>(
 
-          [session_id, this](const flutter::EncodableValue *success_value) {
+          [session_id, requested_at,
+           this](const flutter::EncodableValue *success_value) {
             std::vector<uint8_t> response;
             if (std::holds_alternative<std::vector<uint8_t>>(*success_value)) {
               response = std::get<std::vector<uint8_t>>(*success_value);
@@ -303,6 +341,8 @@ void DrmManager::RequestLicense(std::string &session_id, std::string &message) {
                            reinterpret_cast<const void *>(session_id.c_str())),
                        reinterpret_cast<void *>(response.data()),
                        reinterpret_cast<void *>(response.size()));
+            LOG_INFO("[DrmManager] License acquired in %lld ms.",
+                     ElapsedMs(requested_at, Clock::now()));
           },
           nullptr, nullptr);
   request_license_channel_->InvokeMethod(
@@ -314,15 +354,78 @@ void DrmManager::RequestLicense(std::string &session_id, std::string &message) {
 
 void DrmManager::PushLicenseRequestData(DataForLicenseProcess &data) {
   std::lock_guard<std::mutex> lock(queue_mutex_);
-  license_request_queue_.push(data);
-  ecore_pipe_write(license_request_pipe_, nullptr, 0);
+  if (!license_server_url_.empty()) {
+    license_server_queue_.push(data);
+    queue_condition_.notify_one();
+  } else {
+    license_request_queue_.push(data);
+    ecore_pipe_write(license_request_pipe_, nullptr, 0);
+  }
 }
 
 void DrmManager::ExecuteRequest() {
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  while (!license_request_queue_.empty()) {
-    DataForLicenseProcess data = license_request_queue_.front();
-    ProcessLicense(data);
-    license_request_queue_.pop();
+  std::queue<DataForLicenseProcess> requests;
+  std::queue<LicenseResponse> responses;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    std::swap(requests, license_request_queue_);
+    std::swap(responses, license_response_queue_);
+  }
+  while (!requests.empty()) {
+    RequestLicense(requests.front());
+    requests.pop();
+  }
+  while (!responses.empty()) {
+    InstallLicense(responses.front());
+    responses.pop();
+  }
+}
+
+void DrmManager::StartLicenseWorker() {
+  if (license_worker_.joinable()) {
+    return;
+  }
+  stop_license_worker_ = false;
+  license_http_context_.cancel_request = false;
+  license_worker_ = std::thread(&DrmManager::RunLicenseWorker, this);
+}
+
+void DrmManager::StopLicenseWorker() {
+  if (!license_worker_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    stop_license_worker_ = true;
+    license_server_queue_ = std::queue<DataForLicenseProcess>();
+    license_response_queue_ = std::queue<LicenseResponse>();
+  }
+  license_http_context_.cancel_request = true;
+  queue_condition_.notify_one();
+  license_worker_.join();
+}
+
+void DrmManager::RunLicenseWorker() {
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  while (true) {
+    queue_condition_.wait(lock, [this] {
+      return stop_license_worker_ || !license_server_queue_.empty();
+    });
+    if (stop_license_worker_) {
+      break;
+    }
+    DataForLicenseProcess data = std::move(license_server_queue_.front());
+    license_server_queue_.pop();
+    std::string license_server_url = license_server_url_;
+    lock.unlock();
+
+    LicenseResponse response;
+    bool success = FetchLicense(data, license_server_url, response);
+
+    lock.lock();
+    if (success && !stop_license_worker_) {
+      license_response_queue_.push(std::move(response));
+      ecore_pipe_write(license_request_pipe_, nullptr, 0);
+    }
   }
 }
@@ -8,8 +8,14 @@
 #include <Ecore.h>
 #include <flutter/method_channel.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <vector>
+
+#include "drm_license_helper.h"
 
 class DrmManager {
  public:
@@ -34,25 +40,42 @@ class DrmManager {
   void ReleaseDrmSession();
 
  private:
+  using Clock = std::chrono::steady_clock;
+
   struct DataForLicenseProcess {
     DataForLicenseProcess(void *session_id, void *message, int message_length)
         : session_id(static_cast<char *>(session_id)),
           message(static_cast<char *>(message), message_length) {}
     std::string session_id;
     std::string message;
+    Clock::time_point requested_at = Clock::now();
+  };
+
+  struct LicenseResponse {
+    std::string session_id;
+    std::vector<uint8_t> data;
+    Clock::time_point requested_at;
+    Clock::time_point sent_at;
+    Clock::time_point received_at;
   };
 
-  void RequestLicense(std::string &session_id, std::string &message);
+  void RequestLicense(const DataForLicenseProcess &data);
   void InstallKey(void *session_id, void *response_data, void *response_len);
+  void InstallLicense(LicenseResponse &response);
   int SetChallenge(const std::string &media_url);
 
   static int OnChallengeData(void *session_id, int message_type, void *message,
                              int message_length, void *user_data);
   static void OnDrmManagerError(long error_code, char *error_message,
                                 void *user_data);
-  bool ProcessLicense(DataForLicenseProcess &data);
+  bool FetchLicense(const DataForLicenseProcess &data,
+                    const std::string &license_server_url,
+                    LicenseResponse &response);
   void PushLicenseRequestData(DataForLicenseProcess &data);
   void ExecuteRequest();
+  void StartLicenseWorker();
+  void StopLicenseWorker();
+  void RunLicenseWorker();
 
   std::unique_ptr<flutter::MethodChannel<flutter::EncodableValue>>
       request_license_channel_;
@@ -62,8 +85,18 @@ class DrmManager {
   int drm_type_;
   std::string license_server_url_;
   std::mutex queue_mutex_;
+  std::condition_variable queue_condition_;
   Ecore_Pipe *license_request_pipe_ = nullptr;
+  // Requests to be passed to the Dart callback on the main thread.
   std::queue<DataForLicenseProcess> license_request_queue_;
+  // Requests to be sent to the license server by |license_worker_|, so that
+  // the blocking HTTP transactions do not stall the main loop.
+  std::queue<DataForLicenseProcess> license_server_queue_;
+  // Licenses received by |license_worker_| to be installed on the main thread.
+  std::queue<LicenseResponse> license_response_queue_;
+  DrmLicenseHelper::SExtensionCtxTZ license_http_context_;
+  bool stop_license_worker_ = false;
+  std::thread license_worker_;
 };
 
 #endif  // FLUTTER_PLUGIN_DRM_MANAGER_H_
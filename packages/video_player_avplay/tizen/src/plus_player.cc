@@ -1132,24 +1132,21 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
                                 const uint64_t duration,
                                 plusplayer::SubtitleAttributeListPtr attr_list,
                                 void *user_data) {
-  LOG_INFO("[PlusPlayer] Subtitle updated, duration: %llu, text: %s", duration,
-           data);
+  LOG_DEBUG("[PlusPlayer] Subtitle updated, duration: %llu, text: %s", duration,
+            data);
   PlusPlayer *self = reinterpret_cast<PlusPlayer *>(user_data);
 
   plusplayer::SubtitleAttributeList *attrs = attr_list.get();
+  // A flat list of (type, start time, stop time, value) tuples, which is
+  // much cheaper to encode than a map per attribute.
   flutter::EncodableList attributes_list;
+  attributes_list.reserve(attrs->size() * 4);
   for (auto attr = attrs->begin(); attr != attrs->end(); attr++) {
-    LOG_INFO("[PlusPlayer] Subtitle update: type: %d, start: %u, end: %u",
-             attr->type, attr->start_time, attr->stop_time);
-    flutter::EncodableMap attributes = {
-        {flutter::EncodableValue("attrType"),
-         flutter::EncodableValue(attr->type)},
-        {flutter::EncodableValue("startTime"),
-         flutter::EncodableValue((int64_t)attr->start_time)},
-        {flutter::EncodableValue("stopTime"),
-         flutter::EncodableValue((int64_t)attr->stop_time)},
-    };
-
+#ifndef NDEBUG
+    LOG_DEBUG("[PlusPlayer] Subtitle update: type: %d, start: %u, end: %u",
+              attr->type, attr->start_time, attr->stop_time);
+#endif
+    flutter::EncodableValue attr_value;
     switch (attr->type) {
       case plusplayer::kSubAttrRegionXPos:
       case plusplayer::kSubAttrRegionYPos:
@@ -1167,9 +1164,7 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
         intptr_t value_temp = reinterpret_cast<intptr_t>(attr->value);
         float value_float;
         std::memcpy(&value_float, &value_temp, sizeof(float));
-        LOG_INFO("[PlusPlayer] Subtitle update: value<float>: %f", value_float);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue((double)value_float);
+        attr_value = flutter::EncodableValue((double)value_float);
       } break;
       case plusplayer::kSubAttrWindowLeftMargin:
       case plusplayer::kSubAttrWindowRightMargin:
@@ -1192,33 +1187,27 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
       case plusplayer::kSubAttrWebvttCueVertical:
       case plusplayer::kSubAttrTimestamp: {
         int value_int = reinterpret_cast<int>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<int>: %d", value_int);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue(value_int);
+        attr_value = flutter::EncodableValue(value_int);
       } break;
       case plusplayer::kSubAttrFontFamily:
       case plusplayer::kSubAttrRawSubtitle: {
         const char *value_chars = reinterpret_cast<const char *>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<char *>: %s",
-                 value_chars);
-        std::string value_string(value_chars);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue(value_string);
+        attr_value = flutter::EncodableValue(std::string(value_chars));
       } break;
       case plusplayer::kSubAttrWindowShowBg: {
         uint32_t value_uint32 = reinterpret_cast<uint32_t>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<uint32_t>: %u",
-                 value_uint32);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue((int64_t)value_uint32);
+        attr_value = flutter::EncodableValue((int64_t)value_uint32);
       } break;
       default:
         LOG_ERROR("[PlusPlayer] Unknown Subtitle type: %d", attr->type);
         break;
     }
-    attributes_list.push_back(flutter::EncodableValue(attributes));
+    attributes_list.emplace_back(attr->type);
+    attributes_list.emplace_back((int64_t)attr->start_time);
+    attributes_list.emplace_back((int64_t)attr->stop_time);
+    attributes_list.push_back(std::move(attr_value));
   }
-  self->SendSubtitleUpdate(duration, data, attributes_list);
+  self->SendSubtitleUpdate(duration, data, std::move(attributes_list));
 }
 
 void PlusPlayer::OnResourceConflicted(void *user_data) {
@@ -80,6 +80,7 @@ void VideoPlayer::ExecuteSinkEvents() {
     }
     encodable_event_queue_.pop();
   }
+  has_pending_subtitle_update_ = false;
 
   while (!error_event_queue_.empty()) {
     if (event_sink_) {
@@ -90,13 +91,21 @@ void VideoPlayer::ExecuteSinkEvents() {
   }
 }
 
-void VideoPlayer::PushEvent(flutter::EncodableValue encodable_value) {
+void VideoPlayer::PushEvent(flutter::EncodableValue encodable_value,
+                            bool is_subtitle_update) {
   std::lock_guard<std::mutex> lock(queue_mutex_);
   if (event_sink_ == nullptr) {
     LOG_ERROR("[VideoPlayer] event sink is nullptr.");
     return;
   }
-  encodable_event_queue_.push(encodable_value);
+  if (is_subtitle_update && has_pending_subtitle_update_) {
+    // Cues arriving before the main loop could send the previous one would
+    // replace it on the screen anyway.
+    encodable_event_queue_.back() = std::move(encodable_value);
+    return;
+  }
+  encodable_event_queue_.push(std::move(encodable_value));
+  has_pending_subtitle_update_ = is_subtitle_update;
   ecore_pipe_write(sink_event_pipe_, nullptr, 0);
 }
 
@@ -155,10 +164,10 @@ void VideoPlayer::SendSubtitleUpdate(int32_t duration, const std::string &text,
       {flutter::EncodableValue("duration"), flutter::EncodableValue(duration)},
       {flutter::EncodableValue("text"), flutter::EncodableValue(text)},
       {flutter::EncodableValue("attributes"),
-       flutter::EncodableValue(attributes)},
+       flutter::EncodableValue(std::move(attributes))},
   };
 
-  PushEvent(flutter::EncodableValue(result));
+  PushEvent(flutter::EncodableValue(std::move(result)), true);
 }
 
 void VideoPlayer::SendPlayCompleted() {
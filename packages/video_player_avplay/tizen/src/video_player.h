@@ -82,6 +82,8 @@ class VideoPlayer {
   void SendBufferingStart();
   void SendBufferingUpdate(int32_t value);
   void SendBufferingEnd();
+  // |attributes| is a flat list of (type, start time, stop time, value)
+  // tuples. An update that has not been sent yet is replaced by a newer one.
   void SendSubtitleUpdate(
       int32_t duration, const std::string &text,
       flutter::EncodableList attributes = flutter::EncodableList{});
@@ -101,9 +103,12 @@ class VideoPlayer {
 
  private:
   void ExecuteSinkEvents();
-  void PushEvent(flutter::EncodableValue encodable_value);
+  void PushEvent(flutter::EncodableValue encodable_value,
+                 bool is_subtitle_update = false);
 
   std::queue<flutter::EncodableValue> encodable_event_queue_;
+  // Whether the last event in |encodable_event_queue_| is a subtitle update.
+  bool has_pending_subtitle_update_ = false;
   std::queue<std::pair<std::string, std::string>> error_event_queue_;
   std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>>
       event_channel_;
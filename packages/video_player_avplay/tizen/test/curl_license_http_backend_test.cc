@@ -0,0 +1,171 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "curl_license_http_backend.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "drm_license_helper.h"
+#include "sample_challenges.h"
+#include "stub_license_server.h"
+
+namespace {
+
+using Request = StubLicenseServer::Request;
+using Response = StubLicenseServer::Response;
+
+Response EchoLicense(const Request& request) {
+  Response response;
+  response.body = "license:" + std::to_string(request.body.size());
+  return response;
+}
+
+class CurlLicenseHttpBackendTest : public ::testing::Test {
+ protected:
+  DRM_RESULT DoTransaction(const std::string& url,
+                           const std::string& challenge,
+                           DrmLicenseHelper::DrmType type) {
+    free(response_);
+    response_ = nullptr;
+    return DrmLicenseHelper::DoTransactionTZ(
+        url.c_str(), challenge.data(), challenge.size(), &response_,
+        &response_len_, type, nullptr, &context_);
+  }
+
+  std::string GetResponse() const {
+    return std::string(reinterpret_cast<const char*>(response_),
+                       response_len_);
+  }
+
+  void TearDown() override { free(response_); }
+
+  DrmLicenseHelper::SExtensionCtxTZ context_;
+  unsigned char* response_ = nullptr;
+  unsigned long response_len_ = 0;
+};
+
+TEST_F(CurlLicenseHttpBackendTest, SendsChallenge) {
+  StubLicenseServer server(EchoLicense);
+  ASSERT_TRUE(server.IsRunning());
+
+  ASSERT_EQ(DoTransaction(server.GetUrl("/license"), GetPlayReadyChallenge(),
+                          DrmLicenseHelper::kPlayReady),
+            DRM_SUCCESS);
+  EXPECT_EQ(GetResponse(),
+            "license:" + std::to_string(GetPlayReadyChallenge().size()));
+
+  std::vector<Request> requests = server.GetRequests();
+  ASSERT_EQ(requests.size(), 1u);
+  EXPECT_EQ(requests[0].method, "POST");
+  EXPECT_EQ(requests[0].path, "/license");
+  EXPECT_EQ(requests[0].body, GetPlayReadyChallenge());
+  EXPECT_TRUE(requests[0].HasHeader("SOAPAction"));
+}
+
+// A challenge larger than 1 KB makes curl send "Expect: 100-continue" and
+// wait up to a second for an interim response unless the header is removed.
+TEST_F(CurlLicenseHttpBackendTest, DoesNotWaitForContinue) {
+  StubLicenseServer server(EchoLicense);
+  ASSERT_TRUE(server.IsRunning());
+
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_EQ(DoTransaction(server.GetUrl(), GetPlayReadyChallenge(),
+                          DrmLicenseHelper::kPlayReady),
+            DRM_SUCCESS);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_FALSE(server.GetRequests()[0].HasHeader("Expect"));
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+}
+
+TEST_F(CurlLicenseHttpBackendTest, ReusesConnection) {
+  StubLicenseServer server(EchoLicense);
+  ASSERT_TRUE(server.IsRunning());
+
+  for (int i = 0; i < 5; i++) {
+    ASSERT_EQ(DoTransaction(server.GetUrl(), GetWidevineChallenge(),
+                            DrmLicenseHelper::kWidevine),
+              DRM_SUCCESS);
+  }
+  EXPECT_EQ(server.GetRequests().size(), 5u);
+  EXPECT_EQ(server.GetConnectionCount(), 1);
+}
+
+TEST_F(CurlLicenseHttpBackendTest, ReconnectsWhenServerClosesConnection) {
+  StubLicenseServer server(EchoLicense, false);
+  ASSERT_TRUE(server.IsRunning());
+
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(DoTransaction(server.GetUrl(), GetWidevineChallenge(),
+                            DrmLicenseHelper::kWidevine),
+              DRM_SUCCESS);
+  }
+  EXPECT_EQ(server.GetConnectionCount(), 3);
+}
+
+TEST_F(CurlLicenseHttpBackendTest, FollowsRedirect) {
+  StubLicenseServer server(EchoLicense);
+  ASSERT_TRUE(server.IsRunning());
+
+  StubLicenseServer redirecting_server([&server](const Request& request) {
+    Response response;
+    response.status_code = 302;
+    response.headers.push_back("Content-Location: " + server.GetUrl("/wrong"));
+    response.headers.push_back("Location: " + server.GetUrl("/license"));
+    return response;
+  });
+  ASSERT_TRUE(redirecting_server.IsRunning());
+
+  ASSERT_EQ(DoTransaction(redirecting_server.GetUrl(), GetWidevineChallenge(),
+                          DrmLicenseHelper::kWidevine),
+            DRM_SUCCESS);
+  EXPECT_EQ(GetResponse(),
+            "license:" + std::to_string(GetWidevineChallenge().size()));
+  std::vector<Request> requests = server.GetRequests();
+  ASSERT_EQ(requests.size(), 1u);
+  EXPECT_EQ(requests[0].path, "/license");
+  EXPECT_EQ(requests[0].body, GetWidevineChallenge());
+}
+
+TEST_F(CurlLicenseHttpBackendTest, ServerError) {
+  StubLicenseServer server([](const Request& request) {
+    Response response;
+    response.status_code = 503;
+    return response;
+  });
+  ASSERT_TRUE(server.IsRunning());
+
+  EXPECT_EQ(DoTransaction(server.GetUrl(), GetWidevineChallenge(),
+                          DrmLicenseHelper::kWidevine),
+            DRM_E_NETWORK_SERVER);
+}
+
+TEST_F(CurlLicenseHttpBackendTest, ConnectionRefused) {
+  std::string url;
+  {
+    StubLicenseServer server(EchoLicense);
+    url = server.GetUrl();
+  }
+
+  EXPECT_EQ(
+      DoTransaction(url, GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+      DRM_E_NETWORK_CURL);
+}
+
+TEST_F(CurlLicenseHttpBackendTest, Canceled) {
+  StubLicenseServer server(EchoLicense);
+  ASSERT_TRUE(server.IsRunning());
+  context_.cancel_request = true;
+
+  EXPECT_EQ(DoTransaction(server.GetUrl(), GetWidevineChallenge(),
+                          DrmLicenseHelper::kWidevine),
+            DRM_E_NETWORK_CANCELED);
+}
+
+}  // namespace
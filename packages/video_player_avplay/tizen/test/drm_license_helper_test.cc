@@ -0,0 +1,252 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "drm_license_helper.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "fake_license_http_backend.h"
+#include "sample_challenges.h"
+
+namespace {
+
+constexpr char kServerUrl[] = "https://license.example.com/license";
+
+class DrmLicenseHelperTest : public ::testing::Test {
+ protected:
+  void SetUp() override { context_.http_backend = &backend_; }
+
+  void TearDown() override { free(response_); }
+
+  DRM_RESULT DoTransaction(const std::string& challenge,
+                           DrmLicenseHelper::DrmType type,
+                           const char* cookie = nullptr) {
+    return DrmLicenseHelper::DoTransactionTZ(
+        kServerUrl, challenge.data(), challenge.size(), &response_,
+        &response_len_, type, cookie, &context_);
+  }
+
+  std::string GetResponse() const {
+    return std::string(reinterpret_cast<const char*>(response_),
+                       response_len_);
+  }
+
+  bool HasHeader(const LicenseHttpRequest& request,
+                 const std::string& header) const {
+    return std::find(request.headers.begin(), request.headers.end(),
+                     header) != request.headers.end();
+  }
+
+  FakeLicenseHttpBackend backend_;
+  DrmLicenseHelper::SExtensionCtxTZ context_;
+  unsigned char* response_ = nullptr;
+  unsigned long response_len_ = 0;
+};
+
+TEST_F(DrmLicenseHelperTest, PlayReadyRequest) {
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetPlayReadyChallenge(),
+                          DrmLicenseHelper::kPlayReady),
+            DRM_SUCCESS);
+  EXPECT_EQ(GetResponse(), "license");
+
+  ASSERT_EQ(backend_.requests().size(), 1u);
+  const LicenseHttpRequest& request = backend_.requests()[0];
+  EXPECT_EQ(request.url, kServerUrl);
+  EXPECT_EQ(request.body, GetPlayReadyChallenge());
+  EXPECT_TRUE(HasHeader(request, "User-Agent: PlayReadyClient"));
+  EXPECT_TRUE(HasHeader(request, "Content-Type: text/xml; charset=utf-8\r\n"
+                                 "SOAPAction: \"http://schemas.microsoft.com/"
+                                 "DRM/2007/03/protocols/AcquireLicense\""));
+  EXPECT_TRUE(HasHeader(request, "Expect:"));
+  EXPECT_EQ(request.cancel_request, &context_.cancel_request);
+}
+
+TEST_F(DrmLicenseHelperTest, WidevineRequest) {
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine,
+                          "session=1"),
+            DRM_SUCCESS);
+
+  ASSERT_EQ(backend_.requests().size(), 1u);
+  const LicenseHttpRequest& request = backend_.requests()[0];
+  EXPECT_EQ(request.body, GetWidevineChallenge());
+  EXPECT_TRUE(HasHeader(request, "User-Agent: Widevine CDM v1.0"));
+  EXPECT_TRUE(HasHeader(request, "Content-Type: application/octet-stream"));
+  EXPECT_TRUE(HasHeader(request, "Cookie: session=1"));
+  EXPECT_TRUE(HasHeader(request, "Expect:"));
+}
+
+TEST_F(DrmLicenseHelperTest, CustomHeaders) {
+  char user_agent[] = "TestAgent";
+  char header[] = "X-Token: abc";
+  context_.http_user_agent = user_agent;
+  context_.http_header = header;
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_SUCCESS);
+
+  const LicenseHttpRequest& request = backend_.requests()[0];
+  EXPECT_TRUE(HasHeader(request, "User-Agent: TestAgent"));
+  EXPECT_FALSE(HasHeader(request, "User-Agent: Widevine CDM v1.0"));
+  EXPECT_TRUE(HasHeader(request, "X-Token: abc"));
+}
+
+TEST_F(DrmLicenseHelperTest, InvalidDrmType) {
+  EXPECT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kNone),
+            DRM_E_NETWORK_HEADER);
+  EXPECT_EQ(backend_.request_count(), 0u);
+}
+
+TEST_F(DrmLicenseHelperTest, SoapHeaderInsertedBeforeBody) {
+  char soap_header[] = "<CustomData>data</CustomData>";
+  context_.http_soap_header = soap_header;
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetPlayReadyChallenge(),
+                          DrmLicenseHelper::kPlayReady),
+            DRM_SUCCESS);
+
+  const std::string& body = backend_.requests()[0].body;
+  EXPECT_EQ(body.size(), GetPlayReadyChallenge().size() +
+                             strlen("<soap:Header></soap:Header>") +
+                             strlen(soap_header));
+  size_t header_pos =
+      body.find("<soap:Header><CustomData>data</CustomData></soap:Header>");
+  ASSERT_NE(header_pos, std::string::npos);
+  EXPECT_LT(header_pos, body.find("<soap:Body>"));
+}
+
+TEST_F(DrmLicenseHelperTest, SoapHeaderAppendedToExistingHeader) {
+  char soap_header[] = "<CustomData>data</CustomData>";
+  context_.http_soap_header = soap_header;
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetPlayReadyChallengeWithHeader(),
+                          DrmLicenseHelper::kPlayReady),
+            DRM_SUCCESS);
+
+  const std::string& body = backend_.requests()[0].body;
+  EXPECT_EQ(body.size(),
+            GetPlayReadyChallengeWithHeader().size() + strlen(soap_header));
+  EXPECT_NE(
+      body.find("<soap:Header><CustomData>data</CustomData></soap:Header>"),
+      std::string::npos);
+}
+
+TEST_F(DrmLicenseHelperTest, SoapHeaderIgnoredForNonSoapMessage) {
+  char soap_header[] = "<CustomData>data</CustomData>";
+  context_.http_soap_header = soap_header;
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_SUCCESS);
+
+  EXPECT_EQ(backend_.requests()[0].body, GetWidevineChallenge());
+}
+
+TEST_F(DrmLicenseHelperTest, FollowsRedirect) {
+  backend_.AddResponse(
+      302, "HTTP/1.1 302 Found\r\nlocation:  https://other.example.com/a \r\n",
+      "");
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetPlayReadyChallenge(),
+                          DrmLicenseHelper::kPlayReady),
+            DRM_SUCCESS);
+  EXPECT_EQ(GetResponse(), "license");
+
+  ASSERT_EQ(backend_.requests().size(), 2u);
+  EXPECT_EQ(backend_.requests()[1].url, "https://other.example.com/a");
+  EXPECT_EQ(backend_.requests()[1].body, GetPlayReadyChallenge());
+}
+
+TEST_F(DrmLicenseHelperTest, IgnoresContentLocation) {
+  backend_.AddResponse(301,
+                       "HTTP/1.1 301 Moved Permanently\r\n"
+                       "Content-Location: https://wrong.example.com/\r\n"
+                       "Location: https://right.example.com/\r\n",
+                       "");
+  backend_.AddResponse(200, "", "license");
+
+  ASSERT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_SUCCESS);
+
+  ASSERT_EQ(backend_.requests().size(), 2u);
+  EXPECT_EQ(backend_.requests()[1].url, "https://right.example.com/");
+}
+
+TEST_F(DrmLicenseHelperTest, RedirectWithoutLocation) {
+  backend_.AddResponse(302,
+                       "HTTP/1.1 302 Found\r\n"
+                       "Content-Location: https://wrong.example.com/\r\n",
+                       "");
+
+  EXPECT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_E_NETWORK_RESPONSE);
+  EXPECT_EQ(backend_.request_count(), 1u);
+  EXPECT_EQ(response_, nullptr);
+  EXPECT_EQ(response_len_, 0u);
+}
+
+TEST_F(DrmLicenseHelperTest, RedirectsExhausted) {
+  for (int i = 0; i < 5; i++) {
+    backend_.AddResponse(302, "Location: https://loop.example.com/\r\n", "");
+  }
+
+  EXPECT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_E_NETWORK_RESPONSE);
+  EXPECT_EQ(backend_.request_count(), 3u);
+  EXPECT_EQ(response_, nullptr);
+}
+
+TEST_F(DrmLicenseHelperTest, StatusCodeMapping) {
+  const std::pair<long, DRM_RESULT> cases[] = {
+      {200, DRM_SUCCESS},
+      {204, DRM_E_NETWORK},
+      {304, DRM_E_NETWORK},
+      {400, DRM_E_NETWORK_CLIENT},
+      {403, DRM_E_NETWORK_CLIENT},
+      {499, DRM_E_NETWORK_CLIENT},
+      {500, DRM_E_NETWORK_SERVER},
+      {503, DRM_E_NETWORK_SERVER},
+      {600, DRM_E_NETWORK},
+  };
+  for (const auto& [status_code, expected] : cases) {
+    backend_.AddResponse(status_code, "", "body");
+    EXPECT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+              expected)
+        << "status code " << status_code;
+    EXPECT_EQ(response_ != nullptr, expected == DRM_SUCCESS);
+    free(response_);
+    response_ = nullptr;
+  }
+}
+
+TEST_F(DrmLicenseHelperTest, EmptyLicense) {
+  backend_.AddResponse(200, "", "");
+
+  EXPECT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_SUCCESS);
+  EXPECT_EQ(response_, nullptr);
+  EXPECT_EQ(response_len_, 0u);
+}
+
+TEST_F(DrmLicenseHelperTest, BackendErrorStopsTransaction) {
+  backend_.AddResponse(0, "", "", DRM_E_NETWORK_CANCELED);
+
+  EXPECT_EQ(DoTransaction(GetWidevineChallenge(), DrmLicenseHelper::kWidevine),
+            DRM_E_NETWORK_CANCELED);
+  EXPECT_EQ(backend_.request_count(), 1u);
+}
+
+}  // namespace
@@ -0,0 +1,65 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_TEST_FAKE_LICENSE_HTTP_BACKEND_H_
+#define FLUTTER_PLUGIN_TEST_FAKE_LICENSE_HTTP_BACKEND_H_
+
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "license_http_backend.h"
+
+// A backend that records the requests and answers them with the queued
+// responses, without any network.
+class FakeLicenseHttpBackend : public LicenseHttpBackend {
+ public:
+  // Queues the result of a later request.
+  void AddResponse(long status_code, const std::string& headers,
+                   const std::string& body, DRM_RESULT result = DRM_SUCCESS) {
+    LicenseHttpResponse response;
+    response.status_code = status_code;
+    response.headers = headers;
+    response.body = body;
+    responses_.push_back({result, response});
+  }
+
+  // Answers the requests with this response once the queue is empty.
+  void SetDefaultResponse(long status_code, const std::string& body) {
+    default_response_.status_code = status_code;
+    default_response_.body = body;
+  }
+
+  DRM_RESULT Send(const LicenseHttpRequest& request,
+                  LicenseHttpResponse& response) override {
+    if (record_requests_) {
+      requests_.push_back(request);
+    }
+    request_count_++;
+    if (responses_.empty()) {
+      response = default_response_;
+      return DRM_SUCCESS;
+    }
+    auto [result, queued_response] = responses_.front();
+    responses_.pop_front();
+    response = queued_response;
+    return result;
+  }
+
+  // Disables recording, e.g. in benchmarks.
+  void set_record_requests(bool record) { record_requests_ = record; }
+
+  const std::vector<LicenseHttpRequest>& requests() const { return requests_; }
+  size_t request_count() const { return request_count_; }
+
+ private:
+  std::deque<std::pair<DRM_RESULT, LicenseHttpResponse>> responses_;
+  LicenseHttpResponse default_response_;
+  std::vector<LicenseHttpRequest> requests_;
+  bool record_requests_ = true;
+  size_t request_count_ = 0;
+};
+
+#endif  // FLUTTER_PLUGIN_TEST_FAKE_LICENSE_HTTP_BACKEND_H_
@@ -0,0 +1,176 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Replays sample PlayReady and Widevine challenges through DrmLicenseHelper
+// and reports the time per license transaction.
+//
+// Usage: license_benchmark [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include "drm_license_helper.h"
+#include "fake_license_http_backend.h"
+#include "sample_challenges.h"
+#include "stub_license_server.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char kSoapHeader[] =
+    "<CustomData>eyJ1c2VySWQiOiIxMjM0NSIsInNlc3Npb25JZCI6ImFiY2RlZiJ9"
+    "</CustomData>";
+
+// Runs |transaction| |iterations| times and prints the mean time per run.
+// Returns false if a transaction has failed.
+bool Measure(const char* name, int iterations,
+             const std::function<DRM_RESULT()>& transaction) {
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    DRM_RESULT result = transaction();
+    if (result != DRM_SUCCESS) {
+      fprintf(stderr, "%s: transaction failed: 0x%lx\n", name, result);
+      return false;
+    }
+  }
+  double elapsed_us =
+      std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+  printf("%-44s %8d runs %10.2f us/run %10.0f runs/s\n", name, iterations,
+         elapsed_us / iterations, iterations * 1e6 / elapsed_us);
+  return true;
+}
+
+DRM_RESULT DoTransaction(const std::string& url, const std::string& challenge,
+                         DrmLicenseHelper::DrmType type,
+                         DrmLicenseHelper::SExtensionCtxTZ* context) {
+  unsigned char* response = nullptr;
+  unsigned long response_len = 0;
+  DRM_RESULT result = DrmLicenseHelper::DoTransactionTZ(
+      url.c_str(), challenge.data(), challenge.size(), &response,
+      &response_len, type, nullptr, context);
+  free(response);
+  return result;
+}
+
+StubLicenseServer::Response ReplyLicense(
+    const StubLicenseServer::Request& request) {
+  StubLicenseServer::Response response;
+  // The size of a typical license response.
+  response.body.assign(2048, 'L');
+  return response;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 10000;
+  if (iterations <= 0) {
+    fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+    return 1;
+  }
+  // Requests to the local server take much longer than the ones served
+  // in memory.
+  int network_iterations = iterations / 20 > 10 ? iterations / 20 : 10;
+  const std::string url = "https://license.example.com/license";
+  char soap_header[sizeof(kSoapHeader)];
+  memcpy(soap_header, kSoapHeader, sizeof(kSoapHeader));
+  bool ok = true;
+
+  printf("Request building (in-memory backend):\n");
+  {
+    FakeLicenseHttpBackend backend;
+    backend.set_record_requests(false);
+    backend.SetDefaultResponse(200, std::string(2048, 'L'));
+    DrmLicenseHelper::SExtensionCtxTZ context;
+    context.http_backend = &backend;
+
+    ok &= Measure("PlayReady", iterations, [&] {
+      return DoTransaction(url, GetPlayReadyChallenge(),
+                           DrmLicenseHelper::kPlayReady, &context);
+    });
+    ok &= Measure("Widevine", iterations, [&] {
+      return DoTransaction(url, GetWidevineChallenge(),
+                           DrmLicenseHelper::kWidevine, &context);
+    });
+
+    context.http_soap_header = soap_header;
+    ok &= Measure("PlayReady, SOAP header inserted", iterations, [&] {
+      return DoTransaction(url, GetPlayReadyChallenge(),
+                           DrmLicenseHelper::kPlayReady, &context);
+    });
+    ok &= Measure("PlayReady, SOAP header appended", iterations, [&] {
+      return DoTransaction(url, GetPlayReadyChallengeWithHeader(),
+                           DrmLicenseHelper::kPlayReady, &context);
+    });
+    context.http_soap_header = nullptr;
+
+    ok &= Measure("PlayReady, 2 redirections", iterations, [&] {
+      backend.AddResponse(302,
+                          "HTTP/1.1 302 Found\r\n"
+                          "Content-Location: https://cdn.example.com/\r\n"
+                          "Location: https://a.example.com/license\r\n",
+                          "");
+      backend.AddResponse(301,
+                          "HTTP/1.1 301 Moved Permanently\r\n"
+                          "Location: https://b.example.com/license\r\n",
+                          "");
+      return DoTransaction(url, GetPlayReadyChallenge(),
+                           DrmLicenseHelper::kPlayReady, &context);
+    });
+  }
+
+  printf("\nLocal license server (curl backend):\n");
+  {
+    StubLicenseServer server(ReplyLicense);
+    StubLicenseServer closing_server(ReplyLicense, false);
+    StubLicenseServer redirecting_server(
+        [&server](const StubLicenseServer::Request& request) {
+          StubLicenseServer::Response response;
+          response.status_code = 302;
+          response.headers.push_back("Location: " + server.GetUrl("/license"));
+          return response;
+        });
+    if (!server.IsRunning() || !closing_server.IsRunning() ||
+        !redirecting_server.IsRunning()) {
+      fprintf(stderr, "Failed to start the local license server.\n");
+      return 1;
+    }
+    DrmLicenseHelper::SExtensionCtxTZ context;
+
+    ok &= Measure("PlayReady, reused connection", network_iterations, [&] {
+      return DoTransaction(server.GetUrl("/license"), GetPlayReadyChallenge(),
+                           DrmLicenseHelper::kPlayReady, &context);
+    });
+    ok &= Measure("Widevine, reused connection", network_iterations, [&] {
+      return DoTransaction(server.GetUrl("/license"), GetWidevineChallenge(),
+                           DrmLicenseHelper::kWidevine, &context);
+    });
+    printf("  %zu requests on %d connection(s)\n", server.GetRequests().size(),
+           server.GetConnectionCount());
+
+    ok &= Measure("PlayReady, new connection per request", network_iterations,
+                  [&] {
+                    return DoTransaction(closing_server.GetUrl("/license"),
+                                         GetPlayReadyChallenge(),
+                                         DrmLicenseHelper::kPlayReady,
+                                         &context);
+                  });
+    printf("  %zu requests on %d connection(s)\n",
+           closing_server.GetRequests().size(),
+           closing_server.GetConnectionCount());
+
+    ok &= Measure("PlayReady, 1 redirection", network_iterations, [&] {
+      return DoTransaction(redirecting_server.GetUrl("/license"),
+                           GetPlayReadyChallenge(),
+                           DrmLicenseHelper::kPlayReady, &context);
+    });
+  }
+
+  return ok ? 0 : 1;
+}
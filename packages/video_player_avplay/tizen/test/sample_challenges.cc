@@ -0,0 +1,106 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "sample_challenges.h"
+
+#include <cstdint>
+
+namespace {
+
+// Returns |length| deterministic base64 characters.
+std::string MakeBase64(size_t length, uint32_t seed) {
+  static const char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string data;
+  data.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    seed = seed * 1103515245u + 12345u;
+    data.push_back(kAlphabet[(seed >> 16) % 64]);
+  }
+  return data;
+}
+
+std::string MakePlayReadyChallenge(const std::string& soap_header) {
+  return "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+         "<soap:Envelope "
+         "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+         "xmlns:xsd=\"http://www.w3.org/2001/XMLSchema\" "
+         "xmlns:soap=\"http://schemas.xmlsoap.org/soap/envelope/\">" +
+         soap_header +
+         "<soap:Body>"
+         "<AcquireLicense xmlns=\"http://schemas.microsoft.com/DRM/2007/03/"
+         "protocols\">"
+         "<challenge><Challenge xmlns=\"http://schemas.microsoft.com/DRM/2007/"
+         "03/protocols/messages\">"
+         "<LA xmlns=\"http://schemas.microsoft.com/DRM/2007/03/protocols\" "
+         "Id=\"SignedData\" xml:space=\"preserve\">"
+         "<Version>1</Version>"
+         "<ContentHeader><WRMHEADER "
+         "xmlns=\"http://schemas.microsoft.com/DRM/2007/03/PlayReadyHeader\" "
+         "version=\"4.0.0.0\"><DATA><PROTECTINFO><KEYLEN>16</KEYLEN>"
+         "<ALGID>AESCTR</ALGID></PROTECTINFO>"
+         "<KID>" +
+         MakeBase64(24, 1) + "</KID><CHECKSUM>" + MakeBase64(12, 2) +
+         "</CHECKSUM><LA_URL>https://license.example.com/rightsmanager.asmx"
+         "</LA_URL></DATA></WRMHEADER></ContentHeader>"
+         "<CLIENTINFO><CLIENTVERSION>10.0.16384.10011</CLIENTVERSION>"
+         "</CLIENTINFO>"
+         "<LicenseNonce>" +
+         MakeBase64(24, 3) +
+         "</LicenseNonce>"
+         "<ClientTime>1700000000</ClientTime>"
+         "<EncryptedData xmlns=\"http://www.w3.org/2001/04/xmlenc#\" "
+         "Type=\"http://www.w3.org/2001/04/xmlenc#Element\">"
+         "<EncryptionMethod "
+         "Algorithm=\"http://www.w3.org/2001/04/xmlenc#aes128-cbc\"/>"
+         "<KeyInfo xmlns=\"http://www.w3.org/2000/09/xmldsig#\">"
+         "<EncryptedKey xmlns=\"http://www.w3.org/2001/04/xmlenc#\">"
+         "<EncryptionMethod "
+         "Algorithm=\"http://schemas.microsoft.com/DRM/2007/03/protocols#ecc256\"/>"
+         "<CipherData><CipherValue>" +
+         MakeBase64(172, 4) +
+         "</CipherValue></CipherData></EncryptedKey></KeyInfo>"
+         "<CipherData><CipherValue>" +
+         MakeBase64(2560, 5) +
+         "</CipherValue></CipherData></EncryptedData></LA>"
+         "<Signature xmlns=\"http://www.w3.org/2000/09/xmldsig#\">"
+         "<SignedInfo><DigestValue>" +
+         MakeBase64(44, 6) + "</DigestValue></SignedInfo><SignatureValue>" +
+         MakeBase64(88, 7) + "</SignatureValue><KeyInfo><KeyValue><ECCKeyValue>"
+         "<PublicKey>" +
+         MakeBase64(88, 8) +
+         "</PublicKey></ECCKeyValue></KeyValue></KeyInfo></Signature>"
+         "</Challenge></challenge></AcquireLicense></soap:Body>"
+         "</soap:Envelope>";
+}
+
+}  // namespace
+
+const std::string& GetPlayReadyChallenge() {
+  static const std::string challenge = MakePlayReadyChallenge("");
+  return challenge;
+}
+
+const std::string& GetPlayReadyChallengeWithHeader() {
+  static const std::string challenge =
+      MakePlayReadyChallenge("<soap:Header></soap:Header>");
+  return challenge;
+}
+
+const std::string& GetWidevineChallenge() {
+  static const std::string challenge = [] {
+    std::string data;
+    uint32_t seed = 9;
+    for (size_t i = 0; i < 2048; i++) {
+      seed = seed * 1103515245u + 12345u;
+      data.push_back(static_cast<char>(seed >> 16));
+    }
+    // The first bytes of a signed license request message.
+    data[0] = 0x08;
+    data[1] = 0x01;
+    data[2] = 0x12;
+    return data;
+  }();
+  return challenge;
+}
@@ -0,0 +1,21 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_TEST_SAMPLE_CHALLENGES_H_
+#define FLUTTER_PLUGIN_TEST_SAMPLE_CHALLENGES_H_
+
+#include <string>
+
+// Returns a PlayReady AcquireLicense SOAP challenge with the layout and the
+// size (about 4 KB) of the challenges generated by the DRM module.
+const std::string& GetPlayReadyChallenge();
+
+// Returns the same challenge with an empty soap:Header element.
+const std::string& GetPlayReadyChallengeWithHeader();
+
+// Returns a binary Widevine license request of the typical size (about
+// 2 KB). The content is deterministic but not a valid protobuf.
+const std::string& GetWidevineChallenge();
+
+#endif  // FLUTTER_PLUGIN_TEST_SAMPLE_CHALLENGES_H_
@@ -0,0 +1,217 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "stub_license_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+namespace {
+
+// The interval at which blocked threads check whether the server stopped.
+constexpr int kPollIntervalMs = 20;
+
+const char* GetReasonPhrase(int status_code) {
+  switch (status_code) {
+    case 200:
+      return "OK";
+    case 301:
+      return "Moved Permanently";
+    case 302:
+      return "Found";
+    case 400:
+      return "Bad Request";
+    case 403:
+      return "Forbidden";
+    case 500:
+      return "Internal Server Error";
+    case 503:
+      return "Service Unavailable";
+    default:
+      return "Unknown";
+  }
+}
+
+bool WriteAll(int fd, const std::string& data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t ret = send(fd, data.data() + written, data.size() - written,
+                       MSG_NOSIGNAL);
+    if (ret <= 0) {
+      return false;
+    }
+    written += ret;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool StubLicenseServer::Request::HasHeader(const std::string& name) const {
+  for (const std::string& header : headers) {
+    if (header.size() > name.size() && header[name.size()] == ':' &&
+        strncasecmp(header.c_str(), name.c_str(), name.size()) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+StubLicenseServer::StubLicenseServer(Handler handler, bool keep_alive)
+    : handler_(std::move(handler)), keep_alive_(keep_alive) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return;
+  }
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t address_len = sizeof(address);
+  if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+      listen(fd, 16) != 0 ||
+      getsockname(fd, reinterpret_cast<sockaddr*>(&address), &address_len) !=
+          0) {
+    close(fd);
+    return;
+  }
+  listen_fd_ = fd;
+  port_ = ntohs(address.sin_port);
+  accept_thread_ = std::thread(&StubLicenseServer::AcceptConnections, this);
+}
+
+StubLicenseServer::~StubLicenseServer() {
+  stopped_ = true;
+  if (accept_thread_.joinable()) {
+    accept_thread_.join();
+  }
+  for (std::thread& thread : connection_threads_) {
+    thread.join();
+  }
+  if (listen_fd_ >= 0) {
+    close(listen_fd_);
+  }
+}
+
+std::string StubLicenseServer::GetUrl(const std::string& path) const {
+  return "http://127.0.0.1:" + std::to_string(port_) + path;
+}
+
+std::vector<StubLicenseServer::Request> StubLicenseServer::GetRequests() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return requests_;
+}
+
+bool StubLicenseServer::WaitReadable(int fd) {
+  pollfd poll_fd = {fd, POLLIN, 0};
+  while (!stopped_) {
+    int ret = poll(&poll_fd, 1, kPollIntervalMs);
+    if (ret > 0) {
+      return true;
+    }
+    if (ret < 0) {
+      return false;
+    }
+  }
+  return false;
+}
+
+void StubLicenseServer::AcceptConnections() {
+  while (WaitReadable(listen_fd_)) {
+    int fd = accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) {
+      continue;
+    }
+    connection_count_++;
+    std::lock_guard<std::mutex> lock(mutex_);
+    connection_threads_.emplace_back(&StubLicenseServer::ServeConnection, this,
+                                     fd);
+  }
+}
+
+bool StubLicenseServer::ReadRequest(int fd, std::string& buffer,
+                                    Request& request) {
+  char chunk[4096];
+  size_t header_end;
+  while ((header_end = buffer.find("\r\n\r\n")) == std::string::npos) {
+    if (!WaitReadable(fd)) {
+      return false;
+    }
+    ssize_t ret = recv(fd, chunk, sizeof(chunk), 0);
+    if (ret <= 0) {
+      return false;
+    }
+    buffer.append(chunk, ret);
+  }
+
+  size_t content_length = 0;
+  size_t line_start = 0;
+  while (line_start < header_end) {
+    size_t line_end = buffer.find("\r\n", line_start);
+    std::string line = buffer.substr(line_start, line_end - line_start);
+    if (line_start == 0) {
+      size_t method_end = line.find(' ');
+      size_t path_end = line.find(' ', method_end + 1);
+      request.method = line.substr(0, method_end);
+      request.path = line.substr(method_end + 1, path_end - method_end - 1);
+    } else {
+      if (strncasecmp(line.c_str(), "Content-Length:", 15) == 0) {
+        content_length = strtoul(line.c_str() + 15, nullptr, 10);
+      }
+      request.headers.push_back(line);
+    }
+    line_start = line_end + 2;
+  }
+
+  size_t body_start = header_end + 4;
+  while (buffer.size() - body_start < content_length) {
+    if (!WaitReadable(fd)) {
+      return false;
+    }
+    ssize_t ret = recv(fd, chunk, sizeof(chunk), 0);
+    if (ret <= 0) {
+      return false;
+    }
+    buffer.append(chunk, ret);
+  }
+  request.body = buffer.substr(body_start, content_length);
+  buffer.erase(0, body_start + content_length);
+  return true;
+}
+
+void StubLicenseServer::ServeConnection(int fd) {
+  std::string buffer;
+  while (true) {
+    Request request;
+    if (!ReadRequest(fd, buffer, request)) {
+      break;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      requests_.push_back(request);
+    }
+
+    Response response = handler_(request);
+    std::string data = "HTTP/1.1 " + std::to_string(response.status_code) +
+                       " " + GetReasonPhrase(response.status_code) + "\r\n";
+    data += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    if (!keep_alive_) {
+      data += "Connection: close\r\n";
+    }
+    for (const std::string& header : response.headers) {
+      data += header + "\r\n";
+    }
+    data += "\r\n" + response.body;
+    if (!WriteAll(fd, data) || !keep_alive_) {
+      break;
+    }
+  }
+  close(fd);
+}
@@ -0,0 +1,74 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_TEST_STUB_LICENSE_SERVER_H_
+#define FLUTTER_PLUGIN_TEST_STUB_LICENSE_SERVER_H_
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A minimal HTTP/1.1 server on the loopback interface that answers license
+// requests in place of a real license server.
+class StubLicenseServer {
+ public:
+  struct Request {
+    std::string method;
+    std::string path;
+    // Header lines without the trailing CRLF.
+    std::vector<std::string> headers;
+    std::string body;
+
+    bool HasHeader(const std::string& name) const;
+  };
+
+  struct Response {
+    int status_code = 200;
+    // Extra header lines without the trailing CRLF.
+    std::vector<std::string> headers;
+    std::string body;
+  };
+
+  using Handler = std::function<Response(const Request&)>;
+
+  // Starts serving on an ephemeral port. If |keep_alive| is false, every
+  // connection is closed after a single response, as done by servers that
+  // do not support persistent connections.
+  explicit StubLicenseServer(Handler handler, bool keep_alive = true);
+  ~StubLicenseServer();
+
+  StubLicenseServer(const StubLicenseServer&) = delete;
+  StubLicenseServer& operator=(const StubLicenseServer&) = delete;
+
+  bool IsRunning() const { return listen_fd_ >= 0; }
+
+  std::string GetUrl(const std::string& path = "/") const;
+
+  // The number of TCP connections accepted so far.
+  int GetConnectionCount() const { return connection_count_.load(); }
+
+  std::vector<Request> GetRequests();
+
+ private:
+  void AcceptConnections();
+  void ServeConnection(int fd);
+  bool ReadRequest(int fd, std::string& buffer, Request& request);
+  bool WaitReadable(int fd);
+
+  Handler handler_;
+  bool keep_alive_;
+  int listen_fd_ = -1;
+  int port_ = 0;
+  std::atomic<bool> stopped_{false};
+  std::atomic<int> connection_count_{0};
+  std::thread accept_thread_;
+  std::mutex mutex_;
+  std::vector<std::thread> connection_threads_;
+  std::vector<Request> requests_;
+};
+
+#endif  // FLUTTER_PLUGIN_TEST_STUB_LICENSE_SERVER_H_
@@ -0,0 +1,245 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "curl_license_http_backend.h"
+
+#include <curl/curl.h>
+
+#include <mutex>
+#include <vector>
+
+#include "log.h"
+
+namespace {
+
+// The maximum number of idle curl handles kept for later requests.
+constexpr size_t kMaxIdleCurlHandles = 4;
+
+// The cache is shared by all players and may be used from any thread.
+class CurlConnectionCache {
+ public:
+  static CurlConnectionCache& GetInstance() {
+    static CurlConnectionCache instance;
+    return instance;
+  }
+
+  // Returns a curl handle attached to the shared caches, or nullptr on
+  // failure.
+  CURL* Acquire();
+
+  // Resets |curl| and keeps it for a later request. The connections it has
+  // opened stay alive in the shared connection cache.
+  void Release(CURL* curl);
+
+ private:
+  CurlConnectionCache();
+  ~CurlConnectionCache();
+
+  static void LockShare(CURL* curl, curl_lock_data data,
+                        curl_lock_access access, void* user_data);
+  static void UnlockShare(CURL* curl, curl_lock_data data, void* user_data);
+
+  CURLSH* share_ = nullptr;
+  std::mutex share_mutexes_[CURL_LOCK_DATA_LAST];
+  std::mutex idle_mutex_;
+  std::vector<CURL*> idle_handles_;
+};
+
+CurlConnectionCache::CurlConnectionCache() {
+  curl_global_init(CURL_GLOBAL_DEFAULT);
+
+  share_ = curl_share_init();
+  if (!share_) {
+    LOG_ERROR("[CurlLicenseHttpBackend] Failed to create curl share handle.");
+    return;
+  }
+  curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, LockShare);
+  curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+  curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+  curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+  curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  CURLSHcode res =
+      curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  if (res != CURLSHE_OK) {
+    // Connections are then only reused by the same curl handle.
+    LOG_INFO("[CurlLicenseHttpBackend] Connection sharing unsupported: %s",
+             curl_share_strerror(res));
+  }
+}
+
+CurlConnectionCache::~CurlConnectionCache() {
+  for (CURL* curl : idle_handles_) {
+    curl_easy_cleanup(curl);
+  }
+  if (share_) {
+    curl_share_cleanup(share_);
+  }
+  curl_global_cleanup();
+}
+
+CURL* CurlConnectionCache::Acquire() {
+  CURL* curl = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    if (!idle_handles_.empty()) {
+      curl = idle_handles_.back();
+      idle_handles_.pop_back();
+    }
+  }
+  if (!curl) {
+    curl = curl_easy_init();
+    if (!curl) {
+      return nullptr;
+    }
+  }
+  if (share_) {
+    curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+  }
+  return curl;
+}
+
+void CurlConnectionCache::Release(CURL* curl) {
+  curl_easy_reset(curl);
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    if (idle_handles_.size() < kMaxIdleCurlHandles) {
+      idle_handles_.push_back(curl);
+      return;
+    }
+  }
+  curl_easy_cleanup(curl);
+}
+
+void CurlConnectionCache::LockShare(CURL* curl, curl_lock_data data,
+                                    curl_lock_access access, void* user_data) {
+  auto* self = static_cast<CurlConnectionCache*>(user_data);
+  self->share_mutexes_[data].lock();
+}
+
+void CurlConnectionCache::UnlockShare(CURL* curl, curl_lock_data data,
+                                      void* user_data) {
+  auto* self = static_cast<CurlConnectionCache*>(user_data);
+  self->share_mutexes_[data].unlock();
+}
+
+size_t ReceiveHeader(char* ptr, size_t size, size_t nmemb, void* user_data) {
+  auto* response = static_cast<LicenseHttpResponse*>(user_data);
+  response->headers.append(ptr, size * nmemb);
+  return size * nmemb;
+}
+
+size_t ReceiveBody(char* ptr, size_t size, size_t nmemb, void* user_data) {
+  auto* response = static_cast<LicenseHttpResponse*>(user_data);
+  response->body.append(ptr, size * nmemb);
+  return size * nmemb;
+}
+
+int OnProgress(void* user_data, curl_off_t total_to_download,
+               curl_off_t now_downloaded, curl_off_t total_to_upload,
+               curl_off_t now_uploaded) {
+  auto* cancel_request = static_cast<std::atomic<bool>*>(user_data);
+  if (cancel_request && cancel_request->load()) {
+    LOG_INFO("[CurlLicenseHttpBackend] curl works canceled.");
+    return 1;
+  }
+  return 0;
+}
+
+void LogConnectionInfo(CURL* curl) {
+  // No new connection means that a cached connection has been reused.
+  long num_connects = 0;
+  double connect_time = 0;
+  double app_connect_time = 0;
+  curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &num_connects);
+  curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME, &connect_time);
+  curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME, &app_connect_time);
+  LOG_INFO(
+      "[CurlLicenseHttpBackend] new connections: %ld, connect: %.3f s, TLS "
+      "handshake: %.3f s",
+      num_connects, connect_time, app_connect_time);
+}
+
+}  // namespace
+
+LicenseHttpBackend& LicenseHttpBackend::GetDefault() {
+  static CurlLicenseHttpBackend backend;
+  return backend;
+}
+
+DRM_RESULT CurlLicenseHttpBackend::Send(const LicenseHttpRequest& request,
+                                        LicenseHttpResponse& response) {
+  CurlConnectionCache& cache = CurlConnectionCache::GetInstance();
+  CURL* curl = cache.Acquire();
+  if (!curl) {
+    LOG_ERROR("[CurlLicenseHttpBackend] Failed to create curl handle.");
+    return DRM_E_NETWORK_CURL;
+  }
+
+  struct curl_slist* headers = nullptr;
+  for (const std::string& header : request.headers) {
+    struct curl_slist* new_headers = curl_slist_append(headers, header.c_str());
+    if (!new_headers) {
+      LOG_ERROR("[CurlLicenseHttpBackend] Failed to set HTTP header.");
+      curl_slist_free_all(headers);
+      cache.Release(curl);
+      return DRM_E_NETWORK_HEADER;
+    }
+    headers = new_headers;
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, request.url.c_str());
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+  // HTTP/1.1 keeps the connection alive for the next license request.
+  curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+  curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+  if (!request.body.empty()) {
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body.data());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE,
+                     static_cast<long>(request.body.size()));
+  } else {
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+  }
+  curl_easy_setopt(curl, CURLOPT_USE_SSL, CURLUSESSL_TRY);
+  curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+  curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+  curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
+  curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+  curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, OnProgress);
+  curl_easy_setopt(curl, CURLOPT_XFERINFODATA, request.cancel_request);
+  curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, ReceiveHeader);
+  curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, ReceiveBody);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+  curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, 1024L * 20L);
+  curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+  CURLcode res = curl_easy_perform(curl);
+  LogConnectionInfo(curl);
+  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response.status_code);
+  LOG_INFO(
+      "[CurlLicenseHttpBackend] after curl_easy_perform: res(%d), response "
+      "code(%ld)",
+      res, response.status_code);
+  curl_slist_free_all(headers);
+  cache.Release(curl);
+
+  switch (res) {
+    case CURLE_OK:
+    // Secure Clock Petition Server returns wrong size.
+    case CURLE_PARTIAL_FILE:
+    case CURLE_SEND_ERROR:
+      return DRM_SUCCESS;
+    case CURLE_OUT_OF_MEMORY:
+      LOG_ERROR("[CurlLicenseHttpBackend] Failed to alloc from curl.");
+      return DRM_E_POINTER;
+    case CURLE_ABORTED_BY_CALLBACK:
+      LOG_ERROR("[CurlLicenseHttpBackend] Network job canceled by caller.");
+      return DRM_E_NETWORK_CANCELED;
+    default:
+      LOG_ERROR("[CurlLicenseHttpBackend] Failed from curl, curl message: %s",
+                curl_easy_strerror(res));
+      return DRM_E_NETWORK_CURL;
+  }
+}
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_PLUGIN_DRM_LICENSE_HELPER_H_
 #define FLUTTER_PLUGIN_DRM_LICENSE_HELPER_H_
 
+#include <atomic>
+
 typedef long DRM_RESULT;
 
 const DRM_RESULT DRM_SUCCESS = 0x00000000L;
@@ -20,6 +22,8 @@ const DRM_RESULT DRM_E_NETWORK_REQUEST = 0x91000006L;
 const DRM_RESULT DRM_E_NETWORK_RESPONSE = 0x91000007L;
 const DRM_RESULT DRM_E_NETWORK_CANCELED = 0x91000008L;
 
+class LicenseHttpBackend;
+
 class DrmLicenseHelper {
  public:
   enum DrmType {
@@ -32,7 +36,10 @@ class DrmLicenseHelper {
     char* http_soap_header = nullptr;
     char* http_header = nullptr;
     char* http_user_agent = nullptr;
-    bool cancel_request = false;
+    // May be set from another thread to abort an ongoing transaction.
+    std::atomic<bool> cancel_request{false};
+    // Sends the requests instead of LicenseHttpBackend::GetDefault() if set.
+    LicenseHttpBackend* http_backend = nullptr;
   };
 
   static DRM_RESULT DoTransactionTZ(const char* http_server_url,
@@ -0,0 +1,49 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_LICENSE_HTTP_BACKEND_H_
+#define FLUTTER_PLUGIN_LICENSE_HTTP_BACKEND_H_
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "drm_license_helper.h"
+
+struct LicenseHttpRequest {
+  std::string url;
+  // Header lines, e.g. "Content-Type: text/xml".
+  std::vector<std::string> headers;
+  // The request is a POST if not empty, and a GET otherwise.
+  std::string body;
+  // The request is aborted when set. May be nullptr.
+  std::atomic<bool>* cancel_request = nullptr;
+};
+
+struct LicenseHttpResponse {
+  long status_code = 0;
+  // The raw header lines of the response.
+  std::string headers;
+  std::string body;
+};
+
+// The transport of license requests.
+//
+// DrmLicenseHelper builds the requests and handles the redirections and
+// status codes, so a backend only has to send a single HTTP request. This
+// allows replacing the network, e.g. with a stub server in host tests.
+class LicenseHttpBackend {
+ public:
+  virtual ~LicenseHttpBackend() = default;
+
+  // Returns the backend that sends requests with curl.
+  static LicenseHttpBackend& GetDefault();
+
+  // Sends |request| and waits for the response. Returns DRM_SUCCESS if a
+  // response has been received, whatever its status code.
+  virtual DRM_RESULT Send(const LicenseHttpRequest& request,
+                          LicenseHttpResponse& response) = 0;
+};
+
+#endif  // FLUTTER_PLUGIN_LICENSE_HTTP_BACKEND_H_